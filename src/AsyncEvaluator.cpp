@@ -0,0 +1,150 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include "config.h"
+#include "AsyncEvaluator.h"
+
+#include <utility>
+
+void AsyncEvaluator::CompletionQueue::push(Completion&& completion) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_completions.emplace_back(std::move(completion));
+    }
+    m_condvar.notify_one();
+}
+
+bool AsyncEvaluator::CompletionQueue::try_pop(Completion& completion) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_completions.empty()) {
+        return false;
+    }
+    completion = std::move(m_completions.front());
+    m_completions.pop_front();
+    return true;
+}
+
+AsyncEvaluator::Completion AsyncEvaluator::CompletionQueue::pop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condvar.wait(lock, [this]{ return !m_completions.empty(); });
+    auto completion = std::move(m_completions.front());
+    m_completions.pop_front();
+    return completion;
+}
+
+AsyncEvaluator::AsyncEvaluator(Network& network, int batch_size, int threads,
+                               LeafBatchStats* stats)
+    : m_network(network), m_batch_size(batch_size), m_stats(stats) {
+    for (auto i = 0; i < threads; i++) {
+        m_threads.emplace_back([this]{ worker(); });
+    }
+}
+
+AsyncEvaluator::~AsyncEvaluator() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_exit = true;
+    }
+    m_condvar.notify_all();
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+}
+
+void AsyncEvaluator::submit(const SearchState* state, void* tag,
+                            CompletionQueue& queue) {
+    auto full = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_requests.push_back({state, tag, &queue});
+        full = m_requests.size() >= size_t(m_batch_size);
+    }
+    if (full) {
+        m_condvar.notify_one();
+    }
+}
+
+void AsyncEvaluator::flush() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_flush = true;
+    }
+    m_condvar.notify_one();
+}
+
+void AsyncEvaluator::worker() {
+    auto batch = std::vector<Request>{};
+    auto states = std::vector<const SearchState*>{};
+    for (;;) {
+        batch.clear();
+        states.clear();
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condvar.wait(lock, [this]{
+                return m_exit
+                       || m_requests.size() >= size_t(m_batch_size)
+                       || (m_flush && !m_requests.empty());
+            });
+            if (m_exit && m_requests.empty()) {
+                return;
+            }
+            while (!m_requests.empty() && batch.size() < size_t(m_batch_size)) {
+                batch.emplace_back(m_requests.front());
+                m_requests.pop_front();
+            }
+            // The flushing thread may wait on what is left, not on this
+            // batch, so the flush holds until the queue is empty.
+            if (m_requests.empty()) {
+                m_flush = false;
+            } else if (m_flush) {
+                m_condvar.notify_one();
+            }
+        }
+        for (const auto& request : batch) {
+            states.emplace_back(request.state);
+        }
+
+        auto results = std::vector<Network::Netresult>{};
+        auto halted = false;
+        try {
+            results = m_network.get_output_batch(states);
+        } catch (NetworkHaltException&) {
+            halted = true;
+        }
+        if (!halted && m_stats) {
+            m_stats->batches++;
+            m_stats->leaves += batch.size();
+        }
+        for (auto i = size_t{0}; i < batch.size(); i++) {
+            batch[i].queue->push({batch[i].tag,
+                                  halted ? Network::Netresult{} : results[i],
+                                  halted});
+        }
+    }
+}
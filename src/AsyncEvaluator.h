@@ -0,0 +1,117 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#ifndef ASYNCEVALUATOR_H_INCLUDED
+#define ASYNCEVALUATOR_H_INCLUDED
+
+#include "config.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Network.h"
+#include "SearchState.h"
+
+// Counters of the batched search, see UCTSearch::play_simulation_batch().
+struct LeafBatchStats {
+    std::atomic<int> batches{0};
+    std::atomic<int> leaves{0};
+    // Descents that ended on a leaf some other descent is evaluating.
+    std::atomic<int> collisions{0};
+
+    void clear() {
+        batches = 0;
+        leaves = 0;
+        collisions = 0;
+    }
+};
+
+/*
+    Network evals for simulations that don't wait for them. A search thread
+    submits the position with a tag and goes on with other simulations.
+    The evaluator threads wait for a full batch, or for a search thread
+    that has nothing else to do, run the batch as one forward pass and post
+    each result to the completion queue of the thread that asked for it.
+*/
+class AsyncEvaluator {
+public:
+    struct Completion {
+        void* tag;
+        Network::Netresult result;
+        // The network was drained, there is no result.
+        bool halted;
+    };
+
+    class CompletionQueue {
+    public:
+        void push(Completion&& completion);
+        bool try_pop(Completion& completion);
+        // Blocks until a completion arrives.
+        Completion pop();
+    private:
+        std::mutex m_mutex;
+        std::condition_variable m_condvar;
+        std::deque<Completion> m_completions;
+    };
+
+    AsyncEvaluator(Network& network, int batch_size, int threads,
+                   LeafBatchStats* stats = nullptr);
+    ~AsyncEvaluator();
+
+    // state has to stay alive until its completion is back.
+    void submit(const SearchState* state, void* tag, CompletionQueue& queue);
+    // A search thread is about to wait for its completions: evaluate what
+    // is queued even if it doesn't fill a batch.
+    void flush();
+
+private:
+    struct Request {
+        const SearchState* state;
+        void* tag;
+        CompletionQueue* queue;
+    };
+    void worker();
+
+    Network& m_network;
+    const int m_batch_size;
+    LeafBatchStats* m_stats;
+
+    std::mutex m_mutex;
+    std::condition_variable m_condvar;
+    std::deque<Request> m_requests;
+    bool m_flush{false};
+    bool m_exit{false};
+    std::vector<std::thread> m_threads;
+};
+
+#endif
@@ -62,11 +62,13 @@ void CPUPipe::initialize(int channels) {
 
 void CPUPipe::winograd_transform_in(const std::vector<float>& in,
                                     std::vector<float>& V,
-                                    const int C) {
+                                    const int C, const int batch_size) {
     constexpr auto W = BOARD_SIZE;
     constexpr auto H = BOARD_SIZE;
     constexpr auto WTILES = WINOGRAD_WTILES;
     constexpr auto P = WINOGRAD_P;
+    // The tiles of all positions of a channel are next to each other.
+    const auto BP = batch_size * P;
 
     constexpr auto Wpad = 2 + WINOGRAD_M * WTILES;
 
@@ -107,10 +109,12 @@ void CPUPipe::winograd_transform_in(const std::vector<float>& in,
         o5 = i1 + i3 * (-5.0f/2.0f) + i5;
     };
 
+    for (auto batch = 0; batch < batch_size; batch++) {
     for (auto ch = 0; ch < C; ch++) {
+        const auto in_offset = (batch * C + ch) * (W*H);
         for (auto yin = 0; yin < H; yin++) {
             for (auto xin = 0; xin < W; xin++) {
-                in_pad[yin + 1][xin + 1] = in[ch*(W*H) + yin*W + xin];
+                in_pad[yin + 1][xin + 1] = in[in_offset + yin*W + xin];
             }
         }
         for (auto block_y = 0; block_y < WTILES; block_y++) {
@@ -163,16 +167,18 @@ void CPUPipe::winograd_transform_in(const std::vector<float>& in,
                 MULTIPLY_B(5)
 
                 if (buffer_entries == 0) {
-                    buffer_offset = ch * P + block_y * WTILES + block_x;
+                    buffer_offset = ch * BP + batch * P + block_y * WTILES + block_x;
                 }
                 buffer_entries++;
 
+                // The next channel isn't contiguous with this one in V
+                // once there is more than one position.
                 if (buffer_entries >= buffersize ||
-                    (ch == C - 1 && block_x == WTILES - 1 && block_y == WTILES - 1)) {
+                    (block_x == WTILES - 1 && block_y == WTILES - 1)) {
 
                     for (auto i = 0; i < WINOGRAD_ALPHA * WINOGRAD_ALPHA; i++) {
                         for (auto entry = 0; entry < buffer_entries; entry++) {
-                            V[i*C*P + buffer_offset + entry] = buffer[i*buffersize + entry];
+                            V[i*C*BP + buffer_offset + entry] = buffer[i*buffersize + entry];
                         }
                     }
                     buffer_entries = 0;
@@ -180,13 +186,16 @@ void CPUPipe::winograd_transform_in(const std::vector<float>& in,
             }
         }
     }
+    }
 }
 
 void CPUPipe::winograd_sgemm(const std::vector<float>& U,
                              const std::vector<float>& V,
                              std::vector<float>& M,
-                             const int C, const int K) {
-    constexpr auto P = WINOGRAD_P;
+                             const int C, const int K,
+                             const int batch_size) {
+    // All positions go through one GEMM per tile element.
+    const auto P = batch_size * WINOGRAD_P;
 
     for (auto b = 0; b < WINOGRAD_TILE; b++) {
         const auto offset_u = b * K * C;
@@ -211,11 +220,12 @@ void CPUPipe::winograd_sgemm(const std::vector<float>& U,
 
 void CPUPipe::winograd_transform_out(const std::vector<float>& M,
                                      std::vector<float>& Y,
-                                     const int K) {
+                                     const int K, const int batch_size) {
     constexpr auto W = BOARD_SIZE;
     constexpr auto H = BOARD_SIZE;
     constexpr auto WTILES = WINOGRAD_WTILES;
     constexpr auto P = WINOGRAD_P;
+    const auto BP = batch_size * P;
 
     // multiple vector [i0..i5] by At and produce [o0..o3]
     // const auto At = std::array<float, WINOGRAD_ALPHA * WINOGRAD_M>
@@ -238,20 +248,21 @@ void CPUPipe::winograd_transform_out(const std::vector<float>& M,
         o3 = t1m2 + t3m4 + t3m4 + i5;
     };
 
+    for (auto batch = 0; batch < batch_size; batch++) {
     for (auto k = 0; k < K; k++) {
         for (auto block_x = 0; block_x < WTILES; block_x++) {
             const auto x = WINOGRAD_M * block_x;
             for (auto block_y = 0; block_y < WTILES; block_y++) {
                 const auto y = WINOGRAD_M * block_y;
 
-                const auto b = block_y * WTILES + block_x;
+                const auto b = batch * P + block_y * WTILES + block_x;
                 using WinogradTile =
                     std::array<std::array<float, WINOGRAD_ALPHA>, WINOGRAD_ALPHA>;
                 WinogradTile temp_m;
                 for (auto xi = 0; xi < WINOGRAD_ALPHA; xi++) {
                     for (auto nu = 0; nu < WINOGRAD_ALPHA; nu++) {
                         temp_m[xi][nu] =
-                            M[(xi*WINOGRAD_ALPHA + nu)*K*P + k*P + b];
+                            M[(xi*WINOGRAD_ALPHA + nu)*K*BP + k*BP + b];
                     }
                 }
                 std::array<std::array<float, WINOGRAD_ALPHA>, WINOGRAD_M> temp;
@@ -272,7 +283,7 @@ void CPUPipe::winograd_transform_out(const std::vector<float>& M,
                     );
                 }
 
-                const auto y_ind = k * H * W + y * W + x;
+                const auto y_ind = (batch * K + k) * H * W + y * W + x;
                 for (auto i = 0; i < WINOGRAD_M; i++) {
                     for (auto j = 0; j < WINOGRAD_M; j++) {
                         if (y + i < H && x + j < W) {
@@ -283,6 +294,7 @@ void CPUPipe::winograd_transform_out(const std::vector<float>& M,
             }
         }
     }
+    }
 }
 
 void CPUPipe::winograd_convolve3(const int outputs,
@@ -290,14 +302,15 @@ void CPUPipe::winograd_convolve3(const int outputs,
                                  const std::vector<float>& U,
                                  std::vector<float>& V,
                                  std::vector<float>& M,
-                                 std::vector<float>& output) {
+                                 std::vector<float>& output,
+                                 const int batch_size) {
 
     constexpr unsigned int filter_len = WINOGRAD_ALPHA * WINOGRAD_ALPHA;
     const auto input_channels = U.size() / (outputs * filter_len);
 
-    winograd_transform_in(input, V, input_channels);
-    winograd_sgemm(U, V, M, input_channels, outputs);
-    winograd_transform_out(M, output, outputs);
+    winograd_transform_in(input, V, input_channels, batch_size);
+    winograd_sgemm(U, V, M, input_channels, outputs, batch_size);
+    winograd_transform_out(M, output, outputs, batch_size);
 }
 
 template<unsigned int filter_size>
@@ -359,9 +372,11 @@ void batchnorm(const size_t channels,
                const float* const eltwise = nullptr) {
     const auto lambda_ReLU = [](const auto val) { return (val > 0.0f) ?
                                                           val : 0.0f; };
-    for (auto c = size_t{0}; c < channels; ++c) {
-        const auto mean = means[c];
-        const auto scale_stddev = stddevs[c];
+    // data holds the channels of every position of the batch in turn.
+    const auto planes = data.size() / spatial_size;
+    for (auto c = size_t{0}; c < planes; ++c) {
+        const auto mean = means[c % channels];
+        const auto scale_stddev = stddevs[c % channels];
         const auto arr = &data[c * spatial_size];
 
         if (eltwise == nullptr) {
@@ -382,6 +397,13 @@ void batchnorm(const size_t channels,
 void CPUPipe::forward(const std::vector<float>& input,
                       std::vector<float>& output_pol,
                       std::vector<float>& output_val) {
+    forward_batch(input, 1, output_pol, output_val);
+}
+
+void CPUPipe::forward_batch(const std::vector<float>& input,
+                            const int batch_size,
+                            std::vector<float>& output_pol,
+                            std::vector<float>& output_val) {
     // Input convolution
     constexpr auto P = WINOGRAD_P;
     // Calculate output channels
@@ -391,24 +413,26 @@ void CPUPipe::forward(const std::vector<float>& input,
     // might be bigger when the network has very few filters
     const auto input_channels = std::max(static_cast<size_t>(output_channels),
                                          static_cast<size_t>(Network::INPUT_CHANNELS));
-    auto conv_out = std::vector<float>(output_channels * NUM_INTERSECTIONS);
+    const auto planes = output_channels * NUM_INTERSECTIONS;
+    auto conv_out = std::vector<float>(batch_size * planes);
 
-    auto V = std::vector<float>(WINOGRAD_TILE * input_channels * P);
-    auto M = std::vector<float>(WINOGRAD_TILE * output_channels * P);
+    auto V = std::vector<float>(WINOGRAD_TILE * input_channels * P * batch_size);
+    auto M = std::vector<float>(WINOGRAD_TILE * output_channels * P * batch_size);
 
-    winograd_convolve3(output_channels, input, m_weights->m_conv_weights[0], V, M, conv_out);
+    winograd_convolve3(output_channels, input, m_weights->m_conv_weights[0], V, M, conv_out,
+                       batch_size);
     batchnorm<NUM_INTERSECTIONS>(output_channels, conv_out,
                                  m_weights->m_batchnorm_means[0].data(),
                                  m_weights->m_batchnorm_stddevs[0].data());
 
     // Residual tower
-    auto conv_in = std::vector<float>(output_channels * NUM_INTERSECTIONS);
-    auto res = std::vector<float>(output_channels * NUM_INTERSECTIONS);
+    auto conv_in = std::vector<float>(batch_size * planes);
+    auto res = std::vector<float>(batch_size * planes);
     for (auto i = size_t{1}; i < m_weights->m_conv_weights.size(); i += 2) {
         auto output_channels = m_input_channels;
         std::swap(conv_out, conv_in);
         winograd_convolve3(output_channels, conv_in,
-                           m_weights->m_conv_weights[i], V, M, conv_out);
+                           m_weights->m_conv_weights[i], V, M, conv_out, batch_size);
         batchnorm<NUM_INTERSECTIONS>(output_channels, conv_out,
                                      m_weights->m_batchnorm_means[i].data(),
                                      m_weights->m_batchnorm_stddevs[i].data());
@@ -416,14 +440,26 @@ void CPUPipe::forward(const std::vector<float>& input,
         std::swap(conv_in, res);
         std::swap(conv_out, conv_in);
         winograd_convolve3(output_channels, conv_in,
-                           m_weights->m_conv_weights[i + 1], V, M, conv_out);
+                           m_weights->m_conv_weights[i + 1], V, M, conv_out, batch_size);
         batchnorm<NUM_INTERSECTIONS>(output_channels, conv_out,
                                      m_weights->m_batchnorm_means[i + 1].data(),
                                      m_weights->m_batchnorm_stddevs[i + 1].data(),
                                      res.data());
     }
-    convolve<1>(Network::OUTPUTS_POLICY, conv_out, m_conv_pol_w, m_conv_pol_b, output_pol);
-    convolve<1>(Network::OUTPUTS_VALUE, conv_out, m_conv_val_w, m_conv_val_b, output_val);
+
+    // The heads are tiny, run them one position at a time.
+    constexpr auto pol_size = Network::OUTPUTS_POLICY * NUM_INTERSECTIONS;
+    constexpr auto val_size = Network::OUTPUTS_VALUE * NUM_INTERSECTIONS;
+    auto tower_out = std::vector<float>(planes);
+    auto pol_out = std::vector<float>(pol_size);
+    auto val_out = std::vector<float>(val_size);
+    for (auto batch = 0; batch < batch_size; batch++) {
+        std::copy_n(begin(conv_out) + batch * planes, planes, begin(tower_out));
+        convolve<1>(Network::OUTPUTS_POLICY, tower_out, m_conv_pol_w, m_conv_pol_b, pol_out);
+        convolve<1>(Network::OUTPUTS_VALUE, tower_out, m_conv_val_w, m_conv_val_b, val_out);
+        std::copy(begin(pol_out), end(pol_out), begin(output_pol) + batch * pol_size);
+        std::copy(begin(val_out), end(val_out), begin(output_val) + batch * val_size);
+    }
 }
 
 void CPUPipe::push_weights(unsigned int /*filter_size*/,
@@ -42,6 +42,10 @@ public:
     virtual void forward(const std::vector<float>& input,
                          std::vector<float>& output_pol,
                          std::vector<float>& output_val);
+    virtual void forward_batch(const std::vector<float>& input,
+                               const int batch_size,
+                               std::vector<float>& output_pol,
+                               std::vector<float>& output_val);
 
     virtual void push_weights(unsigned int filter_size,
                               unsigned int channels,
@@ -50,23 +54,25 @@ public:
 private:
     void winograd_transform_in(const std::vector<float>& in,
                                std::vector<float>& V,
-                               const int C);
+                               const int C, const int batch_size);
 
     void winograd_sgemm(const std::vector<float>& U,
                         const std::vector<float>& V,
                         std::vector<float>& M,
-                        const int C, const int K);
+                        const int C, const int K,
+                        const int batch_size);
 
     void winograd_transform_out(const std::vector<float>& M,
                                 std::vector<float>& Y,
-                                const int K);
+                                const int K, const int batch_size);
 
     void winograd_convolve3(const int outputs,
                             const std::vector<float>& input,
                             const std::vector<float>& U,
                             std::vector<float>& V,
                             std::vector<float>& M,
-                            std::vector<float>& output);
+                            std::vector<float>& output,
+                            const int batch_size);
 
 
     int m_input_channels;
@@ -33,11 +33,17 @@
 #include <cctype>
 #include <algorithm>
 #include <array>
+#include <bitset>
 #include <iostream>
 #include <queue>
 #include <sstream>
 #include <string>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
+#include "Random.h"
+#include "Timing.h"
 #include "Utils.h"
 #include "config.h"
 
@@ -47,6 +53,20 @@ const int FastBoard::NUM_VERTICES;
 const int FastBoard::NO_VERTEX;
 const int FastBoard::PASS;
 const int FastBoard::RESIGN;
+const int FastBoard::NUM_PATTERNS;
+
+static constexpr int pow3(int n) {
+    return n == 0 ? 1 : 3 * pow3(n - 1);
+}
+static_assert(FastBoard::NUM_PATTERNS == pow3(FastBoard::PATTERN_CELLS),
+              "NUM_PATTERNS must cover every neighbourhood");
+
+/// 棋型表, 黑方按连五(长连禁手)算, 白方按五连以上都算赢
+static std::array<std::array<FastBoard::pattern_t, FastBoard::NUM_PATTERNS>, 2> s_patterns;
+/// 邻居位图 -> 对应的三进制数
+static std::array<std::uint16_t, 1 << FastBoard::PATTERN_CELLS> s_ternary;
+/// 每条线上真正在棋盘内的点
+static std::array<std::array<std::uint32_t, FastBoard::NUM_LINES>, 4> s_line_valid;
 
 
 int FastBoard::get_boardsize() const {
@@ -92,8 +112,23 @@ void FastBoard::set_state(int vertex, FastBoard::vertex_t content) {
     assert(vertex >= 0 && vertex < m_numvertices);
     assert(content >= BLACK && content <= INVAL);
 
+    auto old_content = m_state[vertex];
     m_state[vertex] = content;
-    empty_cnt--;
+    empty_cnt += (content == EMPTY) - (old_content == EMPTY);
+
+    if (old_content <= WHITE || content <= WHITE) {
+        auto xy = get_xy(vertex);
+        for (int direction = 0; direction < 4; direction++) {
+            auto index = get_line_index(direction, xy.first, xy.second);
+            auto bit = line_t(1u << get_line_pos(direction, xy.first, xy.second));
+            if (old_content <= WHITE) {
+                m_lines[old_content][direction][index] &= line_t(~bit);
+            }
+            if (content <= WHITE) {
+                m_lines[content][direction][index] |= bit;
+            }
+        }
+    }
 }
 
 FastBoard::vertex_t FastBoard::get_state(int x, int y) const {
@@ -135,6 +170,12 @@ void FastBoard::reset_board(int size) {
         m_state[i]     = INVAL;
     }
 
+    for (auto& color_lines : m_lines) {
+        for (auto& dir_lines : color_lines) {
+            dir_lines.fill(0);
+        }
+    }
+
     for (int i = 0; i < size; i++) {
         for (int j = 0; j < size; j++) {
             int vertex = get_vertex(i, j);
@@ -333,7 +374,7 @@ void FastBoard::set_to_move(int tomove) {
 }
 
 
-bool FastBoard::is_forbidden(int vertex, vertex_t color) const {
+bool FastBoard::is_forbidden_scan(int vertex, vertex_t color) const {
     if (vertex_t(color) == WHITE) {
         return false;
     }
@@ -394,7 +435,7 @@ bool FastBoard::is_forbidden(int vertex, vertex_t color) const {
         } else if (mycolornum == NUM_IN_A_ROW - 1) {
             if (left_blank >= 1 && right_blank >= 1) {
                 m_row_type[direction] = LIVE_FOUR;
-            } else if (left_blank + right_blank == 1) {
+            } else if (left_blank + right_blank >= 1) {
                 m_row_type[direction] = CONG_FOUR;
             }
         } else if (mycolornum == NUM_IN_A_ROW - 2) {
@@ -432,36 +473,357 @@ bool FastBoard::is_forbidden(int vertex, vertex_t color) const {
     return false;
 }
 
-void FastBoard::update_continue_info(int vertex, vertex_t content) {
-    assert(content == BLACK || content == WHITE);
+bool FastBoard::is_forbidden(int vertex, vertex_t color) const {
+    if (vertex_t(color) == WHITE) {
+        return false;
+    }
+    assert(get_state(vertex) == EMPTY);
+    auto xy = get_xy(vertex);
+    bool has_toolong = false;
+    int num_live_three = 0, num_four = 0;
     for (int direction = 0; direction < 4; direction++) {
-        int temp_vertex = vertex + m_dirs[direction];
-        int mycolornum = 1;
-        while (in_table(temp_vertex)) {
-            if (get_state(temp_vertex) == content) {
-                mycolornum++;
-                temp_vertex += m_dirs[direction];
-            } else {
-                break;
+        auto pattern = get_pattern(color, direction, xy.first, xy.second);
+        if (pattern.type == FIVE) {
+            return false;
+        } else if (pattern.type == TOOLONG) {
+            has_toolong = true;
+        } else if (pattern.type == LIVE_TREE) {
+            num_live_three += 1;
+        }
+        num_four += pattern.fours;
+    }
+    return has_toolong || num_four >= 2 || num_live_three >= 2;
+}
+
+/// 取出线上pos点两侧各PATTERN_REACH格, 去掉pos点本身
+/// low_fill是线起点之前的格子的取值, 对"被挡住"的位图来说棋盘外算挡住
+static std::uint32_t pattern_window(std::uint64_t line, int pos,
+                                    std::uint64_t low_fill) {
+    constexpr auto reach = FastBoard::PATTERN_REACH;
+    constexpr auto low_mask = (std::uint64_t{1} << reach) - 1;
+    auto window = ((line << reach) | (low_fill & low_mask)) >> pos;
+    return std::uint32_t((window & low_mask)
+                         | (((window >> (reach + 1)) & low_mask) << reach));
+}
+
+FastBoard::pattern_t FastBoard::get_pattern(int color, int direction,
+                                            int x, int y) const {
+    assert(color == BLACK || color == WHITE);
+    auto index = get_line_index(direction, x, y);
+    auto pos = get_line_pos(direction, x, y);
+    auto own = m_lines[color][direction][index];
+    auto blocked = m_lines[!color][direction][index]
+                   | ~s_line_valid[direction][index];
+    auto own_cells = pattern_window(own, pos, 0);
+    auto blocked_cells = pattern_window(blocked, pos, ~std::uint64_t{0});
+    assert((own_cells & blocked_cells) == 0);
+    return s_patterns[color][s_ternary[own_cells] + 2 * s_ternary[blocked_cells]];
+}
+
+/// cells里自己的棋子记为BLACK, 对方棋子和棋盘外记为INVAL, 中间一格是刚落的子
+/// 返回穿过中间一格的连续棋子数
+static int center_run(const std::array<FastBoard::vertex_t,
+                                       FastBoard::PATTERN_CELLS + 1>& cells) {
+    constexpr auto center = FastBoard::PATTERN_REACH;
+    int run = 1;
+    for (int i = center - 1; i >= 0 && cells[i] == FastBoard::BLACK; i--) {
+        run++;
+    }
+    for (int i = center + 1; i <= 2 * center && cells[i] == FastBoard::BLACK; i++) {
+        run++;
+    }
+    return run;
+}
+
+static bool makes_five(const std::array<FastBoard::vertex_t,
+                                        FastBoard::PATTERN_CELLS + 1>& cells,
+                       bool exact_five) {
+    auto run = center_run(cells);
+    return exact_five ? run == NUM_IN_A_ROW : run >= NUM_IN_A_ROW;
+}
+
+/// 再下一子就能和中间一格连成五的空点(成五点)
+static std::vector<int> five_points(std::array<FastBoard::vertex_t,
+                                               FastBoard::PATTERN_CELLS + 1> cells,
+                                    bool exact_five) {
+    std::vector<int> points;
+    for (int i = 0; i <= FastBoard::PATTERN_CELLS; i++) {
+        if (cells[i] != FastBoard::EMPTY) {
+            continue;
+        }
+        cells[i] = FastBoard::BLACK;
+        if (makes_five(cells, exact_five)) {
+            points.emplace_back(i);
+        }
+        cells[i] = FastBoard::EMPTY;
+    }
+    return points;
+}
+
+/// 两个成五点正好夹住四个子就是活四
+static bool is_live_four(const std::vector<int>& points) {
+    return points.size() == 2 && points[1] - points[0] == NUM_IN_A_ROW;
+}
+
+FastBoard::pattern_t FastBoard::classify_pattern(
+    const std::array<vertex_t, PATTERN_CELLS + 1>& cells, bool exact_five) {
+    assert(cells[PATTERN_REACH] == BLACK);
+    if (makes_five(cells, exact_five)) {
+        return {FIVE, 0};
+    }
+    if (center_run(cells) > NUM_IN_A_ROW) {
+        return {TOOLONG, 0};
+    }
+
+    auto points = five_points(cells, exact_five);
+    if (is_live_four(points)) {
+        return {LIVE_FOUR, 1};
+    } else if (!points.empty()) {
+        /// 成五点不相邻的两个四, 比如X.XXX.X, 同一条线上也算双四
+        return {CONG_FOUR, std::uint8_t(std::min<size_t>(points.size(), 2))};
+    }
+
+    /// 再下一子能成活四的就是活三, 跳三也一样
+    /// 没有检查那个成活四的点本身是不是禁手
+    auto next = cells;
+    for (int i = 0; i <= PATTERN_CELLS; i++) {
+        if (next[i] != EMPTY) {
+            continue;
+        }
+        next[i] = BLACK;
+        auto live = center_run(next) < NUM_IN_A_ROW
+                    && is_live_four(five_points(next, exact_five));
+        next[i] = EMPTY;
+        if (live) {
+            return {LIVE_TREE, 0};
+        }
+    }
+    return {OTHER_TYPE, 0};
+}
+
+void FastBoard::init_patterns() {
+    for (size_t mask = 0; mask < s_ternary.size(); mask++) {
+        std::uint16_t value = 0;
+        for (int i = PATTERN_CELLS - 1; i >= 0; i--) {
+            value = value * 3 + ((mask >> i) & 1);
+        }
+        s_ternary[mask] = value;
+    }
+
+    for (int index = 0; index < NUM_PATTERNS; index++) {
+        /// 三进制每一位: 0空, 1自己, 2挡住
+        std::array<vertex_t, PATTERN_CELLS + 1> cells;
+        cells[PATTERN_REACH] = BLACK;
+        auto rest = index;
+        for (int i = 0; i < PATTERN_CELLS; i++) {
+            auto cell = i < PATTERN_REACH ? i : i + 1;
+            auto digit = rest % 3;
+            rest /= 3;
+            cells[cell] = digit == 0 ? EMPTY : (digit == 1 ? BLACK : INVAL);
+        }
+        s_patterns[BLACK][index] = classify_pattern(cells, true);
+        s_patterns[WHITE][index] = classify_pattern(cells, false);
+    }
+
+    for (int direction = 0; direction < 4; direction++) {
+        s_line_valid[direction].fill(0);
+        for (int x = 0; x < BOARD_SIZE; x++) {
+            for (int y = 0; y < BOARD_SIZE; y++) {
+                s_line_valid[direction][get_line_index(direction, x, y)]
+                    |= 1u << get_line_pos(direction, x, y);
             }
         }
-        int back_direction = direction + 4;
-        temp_vertex = vertex + m_dirs[back_direction];
-        while (in_table(temp_vertex)) {
-            if (get_state(temp_vertex) == content) {
-                mycolornum++;
-                temp_vertex += m_dirs[back_direction];
-            } else {
-                break;
+    }
+}
+
+void FastBoard::pattern_benchmark(int iterations) {
+    /// 固定种子的随机局面, 两种实现在同样的局面上比较
+    Random rng(5489);
+    std::vector<FastBoard> boards(iterations);
+    for (auto& board : boards) {
+        board.reset_board(BOARD_SIZE);
+        auto stones = rng.randfix<NUM_INTERSECTIONS / 2>();
+        for (auto i = 0u; i < stones; i++) {
+            auto x = rng.randfix<BOARD_SIZE>();
+            auto y = rng.randfix<BOARD_SIZE>();
+            if (board.get_state(x, y) == EMPTY) {
+                board.set_state(x, y, vertex_t(i % 2));
             }
         }
-        if (mycolornum > NUM_IN_A_ROW) {
-            has_end = true;
-            winner = content;
-        } else if (mycolornum == NUM_IN_A_ROW) {
-            has_end = true;
-            winner = content;
+    }
+
+    auto run = [&boards](bool use_patterns, int& forbidden) {
+        forbidden = 0;
+        const Time start;
+        for (const auto& board : boards) {
+            for (int x = 0; x < BOARD_SIZE; x++) {
+                for (int y = 0; y < BOARD_SIZE; y++) {
+                    auto vertex = board.get_vertex(x, y);
+                    if (board.get_state(vertex) != EMPTY) {
+                        continue;
+                    }
+                    forbidden += use_patterns ? board.is_forbidden(vertex, BLACK)
+                                              : board.is_forbidden_scan(vertex, BLACK);
+                }
+            }
         }
+        const Time end;
+        return Time::timediff_seconds(start, end);
+    };
+
+    int scan_forbidden, pattern_forbidden;
+    auto scan_time = run(false, scan_forbidden);
+    auto pattern_time = run(true, pattern_forbidden);
+
+    int differ = 0;
+    for (const auto& board : boards) {
+        for (int vertex = 0; vertex < NUM_VERTICES; vertex++) {
+            if (board.get_state(vertex) == EMPTY
+                && board.is_forbidden(vertex, BLACK)
+                   != board.is_forbidden_scan(vertex, BLACK)) {
+                differ++;
+            }
+        }
+    }
+
+    myprintf("%d positions, forbidden points: scan %d, patterns %d, differ %d\n",
+             iterations, scan_forbidden, pattern_forbidden, differ);
+    myprintf("scan %5.3f s, patterns %5.3f s -> %.1fx\n",
+             scan_time, pattern_time, scan_time / std::max(pattern_time, 1e-9));
+}
+
+/// 方向编号与m_dirs一致: 0竖, 1横, 2反斜(x + y不变), 3正斜(x - y不变)
+int FastBoard::get_line_index(int direction, int x, int y) {
+    switch (direction) {
+    case 0:
+        return x;
+    case 1:
+        return y;
+    case 2:
+        return x + y;
+    default:
+        assert(direction == 3);
+        return x - y + BOARD_SIZE - 1;
+    }
+}
+
+int FastBoard::get_line_pos(int direction, int x, int y) {
+    return direction == 0 ? y : x;
+}
+
+/// get_line_index和get_line_pos反过来, 线上一点对应的vertex
+int FastBoard::get_line_vertex(int direction, int index, int pos) {
+    constexpr auto side = BOARD_SIZE + 2;
+    int x, y;
+    switch (direction) {
+    case 0:
+        x = index;
+        y = pos;
+        break;
+    case 1:
+        x = pos;
+        y = index;
+        break;
+    case 2:
+        x = pos;
+        y = index - pos;
+        break;
+    default:
+        assert(direction == 3);
+        x = pos;
+        y = pos - index + BOARD_SIZE - 1;
+    }
+    assert(x >= 0 && x < BOARD_SIZE && y >= 0 && y < BOARD_SIZE);
+    return (y + 1) * side + (x + 1);
+}
+
+/*
+    Checked a whole line at a time: for every cell k of a five, the windows
+    whose other cells are all own stones and whose cell k is empty. Black
+    needs exactly five, so the cells right before and after the window must
+    not be black either.
+*/
+std::vector<int> FastBoard::get_five_points(int color) const {
+    assert(color == BLACK || color == WHITE);
+    std::vector<int> points;
+    for (int direction = 0; direction < 4; direction++) {
+        const auto num_lines = direction < 2 ? BOARD_SIZE : NUM_LINES;
+        for (int index = 0; index < num_lines; index++) {
+            const auto own = std::uint64_t{m_lines[color][direction][index]};
+            if (std::bitset<64>(own).count() < NUM_IN_A_ROW - 1) {
+                continue;
+            }
+            const auto empty = s_line_valid[direction][index]
+                               & ~own & ~std::uint64_t{m_lines[!color][direction][index]};
+            auto starts = ~std::uint64_t{0};
+            if (color == BLACK) {
+                starts = ~(own << 1) & ~(own >> NUM_IN_A_ROW);
+            }
+            auto fives = std::uint64_t{0};
+            for (int k = 0; k < NUM_IN_A_ROW; k++) {
+                auto windows = starts & (empty >> k);
+                for (int j = 0; j < NUM_IN_A_ROW; j++) {
+                    if (j != k) {
+                        windows &= own >> j;
+                    }
+                }
+                fives |= windows << k;
+            }
+            for (int pos = 0; fives != 0; pos++, fives >>= 1) {
+                if (fives & 1) {
+                    points.emplace_back(get_line_vertex(direction, index, pos));
+                }
+            }
+        }
+    }
+    std::sort(begin(points), end(points));
+    points.erase(std::unique(begin(points), end(points)), end(points));
+    return points;
+}
+
+FastBoard::line_t FastBoard::get_line(int color, int direction,
+                                      int x, int y) const {
+    assert(color == BLACK || color == WHITE);
+    assert(direction >= 0 && direction < 4);
+    return m_lines[color][direction][get_line_index(direction, x, y)];
+}
+
+/// 4条线一起判断是否有NUM_IN_A_ROW个以上的连续比特
+bool FastBoard::has_five(std::uint32_t l0, std::uint32_t l1,
+                         std::uint32_t l2, std::uint32_t l3) {
+#ifdef __SSE2__
+    const auto lines = _mm_set_epi32(l3, l2, l1, l0);
+    auto run = lines;
+    for (int shift = 1; shift < NUM_IN_A_ROW; shift++) {
+        run = _mm_and_si128(run,
+                            _mm_srl_epi32(lines, _mm_cvtsi32_si128(shift)));
+    }
+    const auto zero = _mm_cmpeq_epi32(run, _mm_setzero_si128());
+    return _mm_movemask_epi8(zero) != 0xFFFF;
+#else
+    auto run0 = l0, run1 = l1, run2 = l2, run3 = l3;
+    for (int shift = 1; shift < NUM_IN_A_ROW; shift++) {
+        run0 &= l0 >> shift;
+        run1 &= l1 >> shift;
+        run2 &= l2 >> shift;
+        run3 &= l3 >> shift;
+    }
+    return (run0 | run1 | run2 | run3) != 0;
+#endif
+}
+
+void FastBoard::update_continue_info(int vertex, vertex_t content) {
+    assert(content == BLACK || content == WHITE);
+    assert(get_state(vertex) == content);
+    /// 只需要看过落子点的4条线, 连五和长连都算赢
+    auto xy = get_xy(vertex);
+    const auto& lines = m_lines[content];
+    if (has_five(lines[0][get_line_index(0, xy.first, xy.second)],
+                 lines[1][get_line_index(1, xy.first, xy.second)],
+                 lines[2][get_line_index(2, xy.first, xy.second)],
+                 lines[3][get_line_index(3, xy.first, xy.second)])) {
+        has_end = true;
+        winner = content;
     }
     if (empty_cnt == 0 && !has_end) {
         has_end = true;
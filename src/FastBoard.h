@@ -33,8 +33,10 @@
 #include "config.h"
 
 #include <array>
+#include <cstdint>
 #include <queue>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -70,6 +72,38 @@ public:
         OTHER_TYPE = 6
     };
 
+    /*
+        number of lines per direction, a diagonal direction has 2N-1 of them
+    */
+    static constexpr int NUM_LINES = 2 * BOARD_SIZE - 1;
+
+    /*
+        bit plane of one line of the board, bit i is the i-th point of the line
+    */
+    using line_t = std::conditional<BOARD_SIZE <= 8, std::uint8_t,
+                   std::conditional<BOARD_SIZE <= 16, std::uint16_t,
+                                    std::uint32_t>::type>::type;
+
+    /*
+        shape a stone makes along one line, fours counts the distinct
+        fours in the line, a split pattern like X.XXX.X holds two of them
+    */
+    struct pattern_t {
+        row_t type;
+        std::uint8_t fours;
+    };
+
+    /*
+        half width of the window looked at along each line, the point
+        itself plus PATTERN_REACH cells on both sides
+    */
+    static constexpr int PATTERN_REACH = NUM_IN_A_ROW;
+    static constexpr int PATTERN_CELLS = 2 * PATTERN_REACH;
+    /*
+        each neighbour cell is own, empty or blocked (opponent / off board)
+    */
+    static constexpr int NUM_PATTERNS = 59049;  // 3^PATTERN_CELLS
+
     int get_boardsize() const;
     vertex_t get_state(int x, int y) const;
     vertex_t get_state(int vertex) const ;
@@ -80,6 +114,17 @@ public:
 
     /// 五子棋的禁手
     bool is_forbidden(int vertex, vertex_t color) const;
+    /// 旧的逐点扫描实现, 只留给patternbench做对比
+    bool is_forbidden_scan(int vertex, vertex_t color) const;
+
+    /// color在空点(x, y)落子后在direction方向上形成的棋型
+    pattern_t get_pattern(int color, int direction, int x, int y) const;
+    /// color下一步就能连五的所有空点, 按vertex排好序
+    std::vector<int> get_five_points(int color) const;
+
+    /// 启动时建立棋型表
+    static void init_patterns();
+    static void pattern_benchmark(int iterations);
 
     /// 五子棋的输赢函数
     float end_score() const;
@@ -89,6 +134,10 @@ public:
     int get_to_move() const;
     void set_to_move(int color);
 
+    /// 过(x, y)点direction方向上color一方的棋子位图, 以及该点在线上的位置
+    line_t get_line(int color, int direction, int x, int y) const;
+    static int get_line_pos(int direction, int x, int y);
+
     std::string move_to_text(int move) const;
     int text_to_move(std::string move) const;
     std::string move_to_text_sgf(int move) const;
@@ -103,6 +152,8 @@ protected:
     std::array<vertex_t, NUM_VERTICES>         m_state;      /* board contents */
     /// 8个方向用于五子棋判断棋型
     std::array<int, 8>                         m_dirs;       /* movement directions 8 way */
+    /// 每一方在4个方向上的每条线的位图, 方向编号与m_dirs[0..3]一致
+    std::array<std::array<std::array<line_t, NUM_LINES>, 4>, 2> m_lines;
 
     int m_tomove;
     int m_numvertices;
@@ -117,6 +168,13 @@ protected:
     bool in_table(int vertex) const;
     void update_continue_info(int vertex, vertex_t content);
 
+    static int get_line_index(int direction, int x, int y);
+    static int get_line_vertex(int direction, int index, int pos);
+    static pattern_t classify_pattern(const std::array<vertex_t, PATTERN_CELLS + 1>& cells,
+                                      bool exact_five);
+    static bool has_five(std::uint32_t l0, std::uint32_t l1,
+                         std::uint32_t l2, std::uint32_t l3);
+
     void print_columns();
 };
 
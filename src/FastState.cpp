@@ -31,6 +31,7 @@
 #include "FastState.h"
 
 #include <algorithm>
+#include <cassert>
 #include <iterator>
 #include <vector>
 
@@ -43,6 +44,7 @@ using namespace Utils;
 
 void FastState::init_game(int size) {
     board.reset_board(size);
+    reset_legal_mask();
     m_movenum = 0;
     m_komove = FastBoard::NO_VERTEX;
     m_lastmove = FastBoard::NO_VERTEX;
@@ -58,15 +60,58 @@ void FastState::reset_game() {
 
 void FastState::reset_board() {
     board.reset_board(board.get_boardsize());
+    reset_legal_mask();
 }
 
 bool FastState::is_move_legal(int color, int vertex) const {
-    return !cfg_analyze_tags.is_to_avoid(color, vertex, m_movenum) && (
-              vertex == FastBoard::PASS ||
-                 vertex == FastBoard::RESIGN ||
-                 (vertex != m_komove &&
-                      board.get_state(vertex) == FastBoard::EMPTY &&
-                      !board.is_forbidden(vertex, FastBoard::vertex_t(color))));
+    if (cfg_analyze_tags.is_to_avoid(color, vertex, m_movenum)) {
+        return false;
+    }
+    if (vertex == FastBoard::PASS || vertex == FastBoard::RESIGN) {
+        return true;
+    }
+    if (vertex == m_komove || board.get_state(vertex) != FastBoard::EMPTY) {
+        return false;
+    }
+    auto xy = board.get_xy(vertex);
+    return m_legal[color][xy.second * BOARD_SIZE + xy.first];
+}
+
+const FastState::movemask_t& FastState::get_legal_mask(int color) const {
+    assert(color == FastBoard::BLACK || color == FastBoard::WHITE);
+    return m_legal[color];
+}
+
+void FastState::reset_legal_mask() {
+    /// 空棋盘上没有禁手
+    m_legal[FastBoard::BLACK].set();
+    m_legal[FastBoard::WHITE].set();
+}
+
+/// 新落的子只会改变同一条线上PATTERN_REACH格以内的空点的禁手状态
+void FastState::update_legal_mask(int vertex) {
+    static constexpr std::array<std::pair<int, int>, 4> dirs{{
+        {0, -1}, {1, 0}, {1, -1}, {1, 1}
+    }};
+    auto xy = board.get_xy(vertex);
+    auto idx = xy.second * BOARD_SIZE + xy.first;
+    m_legal[FastBoard::BLACK].reset(idx);
+    m_legal[FastBoard::WHITE].reset(idx);
+
+    for (const auto& dir : dirs) {
+        for (int dist = -FastBoard::PATTERN_REACH; dist <= FastBoard::PATTERN_REACH; dist++) {
+            auto x = xy.first + dist * dir.first;
+            auto y = xy.second + dist * dir.second;
+            if (dist == 0 || x < 0 || x >= BOARD_SIZE || y < 0 || y >= BOARD_SIZE) {
+                continue;
+            }
+            auto point = board.get_vertex(x, y);
+            if (board.get_state(point) == FastBoard::EMPTY) {
+                m_legal[FastBoard::BLACK][y * BOARD_SIZE + x] =
+                    !board.is_forbidden(point, FastBoard::BLACK);
+            }
+        }
+    }
 }
 
 void FastState::play_move(int vertex) {
@@ -82,17 +127,15 @@ void FastState::play_move(int color, int vertex) {
     } else {
         // 落子并返回
         m_komove = board.update_board(color, vertex);
+        update_legal_mask(vertex);
     }
     board.m_hash ^= Zobrist::zobrist_ko[m_komove];
 
     m_lastmove = vertex;
     m_movenum++;
 
-    if (board.m_tomove == color) {
-        board.m_hash ^= Zobrist::zobrist_blacktomove;
-    }
-    /// 该另一方落子
-    board.m_tomove = !color;
+    /// 该另一方落子, 顺便更新所有对称hash里的行棋方
+    board.set_to_move(!color);
 }
 
 size_t FastState::get_movenum() const {
@@ -126,10 +169,19 @@ std::string FastState::move_to_text(int move) {
 
 /// 此处可实现五子棋的输赢函数 TODO 3
 float FastState::final_score() const {
+    if (!board.game_end() && m_legal[get_to_move()].none()) {
+        /// 只剩禁手可下, 轮到的一方输
+        return get_to_move() == FastBoard::BLACK ? -1.0f : 1.0f;
+    }
     return board.end_score();
     /// return board.area_score(get_komi() + get_handicap());
 }
 
+bool FastState::has_end() const {
+    return board.game_end() || m_legal[get_to_move()].none();
+}
+
 std::uint64_t FastState::get_symmetry_hash(int symmetry) const {
-    return board.calc_symmetry_hash(m_komove, symmetry);
+    assert(m_komove == FastBoard::NO_VERTEX);
+    return board.get_symmetry_hash(symmetry);
 }
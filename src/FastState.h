@@ -32,6 +32,7 @@
 
 #include <cstddef>
 #include <array>
+#include <bitset>
 #include <string>
 #include <vector>
 
@@ -39,18 +40,28 @@
 
 class FastState {
 public:
+    /*
+        points a color may play on, indexed like the policy output
+        (y * BOARD_SIZE + x)
+    */
+    using movemask_t = std::bitset<NUM_INTERSECTIONS>;
+
     void init_game(int size);
     void reset_game();
     void reset_board();
 
     void play_move(int vertex);
     bool is_move_legal(int color, int vertex) const;
+    /// 不考虑analyze tags的合法点, 落子时增量更新
+    const movemask_t& get_legal_mask(int color) const;
 
     int get_to_move() const;
     void set_to_move(int tomove);
 
     /// 此处可实现五子棋的输赢函数 TODO 3
     float final_score() const;
+    /// 连五, 下满, 或者轮到的一方(只可能是黑方)没有不是禁手的点
+    bool has_end() const;
     std::uint64_t get_symmetry_hash(int symmetry) const;
 
     size_t get_movenum() const;
@@ -66,6 +77,10 @@ public:
 
 protected:
     void play_move(int color, int vertex);
+    void reset_legal_mask();
+    void update_legal_mask(int vertex);
+
+    std::array<movemask_t, 2> m_legal;
 };
 
 #endif
@@ -30,6 +30,7 @@
 #ifndef FORWARDPIPE_H_INCLUDED
 #define FORWARDPIPE_H_INCLUDED
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -60,6 +61,25 @@ public:
     virtual void forward(const std::vector<float>& input,
                          std::vector<float>& output_pol,
                          std::vector<float>& output_val) = 0;
+    // Several positions back to back in input and in the outputs. Pipes
+    // without a batched path run them one at a time.
+    virtual void forward_batch(const std::vector<float>& input,
+                               const int batch_size,
+                               std::vector<float>& output_pol,
+                               std::vector<float>& output_val) {
+        const auto in_size = input.size() / batch_size;
+        const auto pol_size = output_pol.size() / batch_size;
+        const auto val_size = output_val.size() / batch_size;
+        auto in = std::vector<float>(in_size);
+        auto pol = std::vector<float>(pol_size);
+        auto val = std::vector<float>(val_size);
+        for (auto i = 0; i < batch_size; i++) {
+            std::copy_n(begin(input) + i * in_size, in_size, begin(in));
+            forward(in, pol, val);
+            std::copy(begin(pol), end(pol), begin(output_pol) + i * pol_size);
+            std::copy(begin(val), end(val), begin(output_val) + i * val_size);
+        }
+    }
     virtual void push_weights(unsigned int filter_size,
                               unsigned int channels,
                               unsigned int outputs,
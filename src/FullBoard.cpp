@@ -29,6 +29,7 @@
 
 #include "config.h"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 
@@ -78,9 +79,22 @@ std::uint64_t FullBoard::get_hash() const {
     return m_hash;
 }
 
+std::uint64_t FullBoard::get_symmetry_hash(int symmetry) const {
+    assert(symmetry >= 0 && symmetry < NUM_SYMMETRIES);
+    return m_symmetry_hash[symmetry];
+}
+
+int FullBoard::get_canonical_symmetry() const {
+    return int(std::min_element(begin(m_symmetry_hash), end(m_symmetry_hash))
+               - begin(m_symmetry_hash));
+}
+
 void FullBoard::set_to_move(int tomove) {
     if (m_tomove != tomove) {
         m_hash ^= Zobrist::zobrist_blacktomove;
+        for (auto& hash : m_symmetry_hash) {
+            hash ^= Zobrist::zobrist_blacktomove;
+        }
     }
     FastBoard::set_to_move(tomove);
 }
@@ -91,6 +105,10 @@ int FullBoard::update_board(const int color, const int i) {
     assert(m_state[i] == EMPTY);
 
     m_hash ^= Zobrist::zobrist[m_state[i]][i];
+    for (auto sym = 0; sym < NUM_SYMMETRIES; sym++) {
+        m_symmetry_hash[sym] ^= Zobrist::zobrist_symmetry[sym][m_state[i]][i]
+                                ^ Zobrist::zobrist_symmetry[sym][color][i];
+    }
     set_state(i, vertex_t(color));
     update_continue_info(i, vertex_t(color));
     m_hash ^= Zobrist::zobrist[m_state[i]][i];
@@ -99,6 +117,21 @@ int FullBoard::update_board(const int color, const int i) {
     return NO_VERTEX;
 }
 
+void FullBoard::undo_board(const int color, const int i) {
+    assert(i != FastBoard::PASS);
+    assert(m_state[i] == color);
+
+    m_hash ^= Zobrist::zobrist[color][i] ^ Zobrist::zobrist[EMPTY][i];
+    for (auto sym = 0; sym < NUM_SYMMETRIES; sym++) {
+        m_symmetry_hash[sym] ^= Zobrist::zobrist_symmetry[sym][color][i]
+                                ^ Zobrist::zobrist_symmetry[sym][EMPTY][i];
+    }
+    set_state(i, EMPTY);
+    // Search doesn't play on after the end, so the game was still on.
+    has_end = false;
+    winner = EMPTY;
+}
+
 void FullBoard::display_board(int lastmove) {
     FastBoard::display_board(lastmove);
 
@@ -109,4 +142,7 @@ void FullBoard::reset_board(int size) {
     FastBoard::reset_board(size);
 
     m_hash = calc_hash();
+    for (auto sym = 0; sym < NUM_SYMMETRIES; sym++) {
+        m_symmetry_hash[sym] = calc_symmetry_hash(NO_VERTEX, sym);
+    }
 }
@@ -31,12 +31,17 @@
 #define FULLBOARD_H_INCLUDED
 
 #include "config.h"
+#include <array>
 #include <cstdint>
 #include "FastBoard.h"
 
 class FullBoard : public FastBoard {
 public:
+    static constexpr auto NUM_SYMMETRIES = 8;
+
     int update_board(const int color, const int i);
+    /// update_board的逆操作, 只用于还没结束的对局里下的子
+    void undo_board(const int color, const int i);
 
     std::uint64_t get_hash() const;
     void set_to_move(int tomove);
@@ -47,8 +52,13 @@ public:
     std::uint64_t calc_hash(int komove = NO_VERTEX) const;
     /// 对称变换一下再hash
     std::uint64_t calc_symmetry_hash(int komove, int symmetry) const;
+    /// 增量维护的对称hash, 等于calc_symmetry_hash(NO_VERTEX, symmetry)
+    std::uint64_t get_symmetry_hash(int symmetry) const;
+    /// 8个对称hash中最小的那个的对称编号, 对称的局面得到同一个hash
+    int get_canonical_symmetry() const;
 
     std::uint64_t m_hash;
+    std::array<std::uint64_t, NUM_SYMMETRIES> m_symmetry_hash;
 
 private:
     template<class Function>
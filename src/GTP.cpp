@@ -73,8 +73,30 @@ int cfg_noise;
 int cfg_random_cnt;
 int cfg_random_min_visits;
 float cfg_random_temp;
+int cfg_fast_visits;
+float cfg_full_search_prob;
+int cfg_selfplay_games;
+std::string cfg_server;
+int cfg_server_searches;
 std::uint64_t cfg_rng_seed;
 bool cfg_dumbpass;
+int cfg_threat_nodes;
+int cfg_threat_depth;
+bool cfg_eval_forced;
+bool cfg_transpositions;
+bool cfg_striping;
+int cfg_leaf_batch;
+int cfg_async_sims;
+int cfg_eval_threads;
+bool cfg_recycle_tree;
+int cfg_root_groups;
+int cfg_ponder_replies;
+bool cfg_gumbel;
+int cfg_gumbel_m;
+std::string cfg_book_file;
+std::string cfg_book_sgf;
+int cfg_book_depth;
+int cfg_book_min_visits;
 #ifdef USE_OPENCL
 std::vector<int> cfg_gpus;
 bool cfg_sgemm_exhaustive;
@@ -98,7 +120,7 @@ bool cfg_quiet;
 std::string cfg_options_str;
 bool cfg_benchmark;
 bool cfg_cpu_only;
-AnalyzeTags cfg_analyze_tags;
+thread_local AnalyzeTags cfg_analyze_tags;
 
 /* Parses tags for the lz-analyze GTP command and friends */
 AnalyzeTags::AnalyzeTags(std::istringstream& cmdstream, const GameState& game) {
@@ -295,6 +317,7 @@ bool AnalyzeTags::has_move_restrictions() const {
 }
 
 std::unique_ptr<Network> GTP::s_network;
+std::unique_ptr<OpeningBook> GTP::s_book;
 
 void GTP::initialize(std::unique_ptr<Network>&& net) {
     s_network = std::move(net);
@@ -354,7 +377,26 @@ void GTP::setup_default_parameters() {
     cfg_random_cnt = 0;
     cfg_random_min_visits = 1;
     cfg_random_temp = 1.0f;
+    cfg_fast_visits = 0;
+    cfg_full_search_prob = 0.25f;
+    cfg_selfplay_games = 1;
+    cfg_server_searches = 2;
     cfg_dumbpass = false;
+    cfg_threat_nodes = 0;
+    cfg_threat_depth = 1;
+    cfg_eval_forced = false;
+    cfg_transpositions = false;
+    cfg_striping = true;
+    cfg_leaf_batch = 1;
+    cfg_async_sims = 0;
+    cfg_eval_threads = 1;
+    cfg_recycle_tree = false;
+    cfg_root_groups = 1;
+    cfg_ponder_replies = 0;
+    cfg_gumbel = false;
+    cfg_gumbel_m = 16;
+    cfg_book_depth = 10;
+    cfg_book_min_visits = 3;
     cfg_logfile_handle = nullptr;
     cfg_quiet = false;
     cfg_benchmark = false;
@@ -411,6 +453,8 @@ const std::string GTP::s_commands[] = {
     "lz-analyze",
     "lz-genmove_analyze",
     "lz-memory_report",
+    "lz-savetree",
+    "lz-loadtree",
     "lz-setoption",
     "gomill-explain_last_move",
     ""
@@ -426,6 +470,8 @@ const std::string GTP::s_options[] = {
     "option name Lagbuffer type spin default 0 min 0 max 3000",
     "option name Resign Percentage type spin default -1 min -1 max 30",
     "option name Pondering type check default true",
+    "option name Book Depth type spin default 10 min 0 max 1000",
+    "option name Book Min Visits type spin default 3 min 1 max 1000000000",
     ""
 };
 
@@ -461,8 +507,13 @@ const std::string GTP::s_options[] = {
 //}
 
 void GTP::execute(GameState & game, const std::string& xinput) {
-    std::string input;
     static auto search = std::make_unique<UCTSearch>(game, *s_network);
+    execute(game, search, xinput);
+}
+
+void GTP::execute(GameState & game, std::unique_ptr<UCTSearch>& search,
+                  const std::string& xinput) {
+    std::string input;
 
     bool transform_lowercase = true;
 
@@ -577,7 +628,8 @@ void GTP::execute(GameState & game, const std::string& xinput) {
         Training::clear_training();
         game.reset_game();
         search = std::make_unique<UCTSearch>(game, *s_network);
-        assert(UCTNodePointer::get_tree_size() == 0);
+        // The server has the trees of its other games.
+        assert(!cfg_server.empty() || UCTNodePointer::get_tree_size() == 0);
         gtp_printf(id, "");
         return;
     } else if (command.find("komi") == 0) {
@@ -1066,6 +1118,57 @@ void GTP::execute(GameState & game, const std::string& xinput) {
         gtp_printf(id, "");
         return;
 
+    } else if (command.find("patternbench") == 0) {
+        std::istringstream cmdstream(command);
+        std::string tmp;
+        int iterations;
+
+        cmdstream >> tmp;  // eat patternbench
+        cmdstream >> iterations;
+
+        if (cmdstream.fail() || iterations <= 0) {
+            iterations = 10000;
+        }
+        FastBoard::pattern_benchmark(iterations);
+        gtp_printf(id, "");
+        return;
+
+    } else if (command.find("stripebench") == 0) {
+        std::istringstream cmdstream(command);
+        std::string tmp;
+        int playouts, positions;
+
+        cmdstream >> tmp;  // eat stripebench
+        cmdstream >> playouts;
+        if (cmdstream.fail() || playouts <= 0) {
+            playouts = 1600;
+        }
+        cmdstream >> positions;
+        if (cmdstream.fail() || positions <= 0) {
+            positions = 8;
+        }
+        UCTSearch::striping_benchmark(*s_network, playouts, positions);
+        gtp_printf(id, "");
+        return;
+
+    } else if (command.find("groupbench") == 0) {
+        std::istringstream cmdstream(command);
+        std::string tmp;
+        int playouts, positions;
+
+        cmdstream >> tmp;  // eat groupbench
+        cmdstream >> playouts;
+        if (cmdstream.fail() || playouts <= 0) {
+            playouts = 1600;
+        }
+        cmdstream >> positions;
+        if (cmdstream.fail() || positions <= 0) {
+            positions = 8;
+        }
+        UCTSearch::group_benchmark(*s_network, playouts, positions);
+        gtp_printf(id, "");
+        return;
+
     } else if (command.find("printsgf") == 0) {
         std::istringstream cmdstream(command);
         std::string tmp, filename;
@@ -1177,6 +1280,22 @@ void GTP::execute(GameState & game, const std::string& xinput) {
             gtp_fail_printf(id, "syntax not understood");
         }
         return;
+    } else if (command.find("build_book") == 0) {
+        std::istringstream cmdstream(command);
+        std::string tmp, sgfname, outname;
+        int depth;
+
+        // tmp will eat build_book
+        cmdstream >> tmp >> sgfname >> outname >> depth;
+
+        if (cmdstream.fail()) {
+            gtp_fail_printf(id, "syntax not understood");
+        } else if (OpeningBook::build(sgfname, outname, depth)) {
+            gtp_printf(id, "");
+        } else {
+            gtp_fail_printf(id, "cannot write book");
+        }
+        return;
     } else if (command.find("lz-memory_report") == 0) {
         auto base_memory = get_base_memory();
         auto tree_size = add_overhead(UCTNodePointer::get_tree_size());
@@ -1188,6 +1307,36 @@ void GTP::execute(GameState & game, const std::string& xinput) {
             "Network with overhead: %d MiB / Search tree: %d MiB / Network cache: %d\n",
             total / MiB, base_memory / MiB, tree_size / MiB, cache_size / MiB);
         return;
+    } else if (command.find("lz-savetree") == 0) {
+        std::istringstream cmdstream(command);
+        std::string tmp, filename;
+
+        // tmp will eat lz-savetree
+        cmdstream >> tmp >> filename;
+
+        if (cmdstream.fail()) {
+            gtp_fail_printf(id, "syntax not understood");
+        } else if (search->save_tree(filename)) {
+            gtp_printf(id, "");
+        } else {
+            gtp_fail_printf(id, "cannot save tree");
+        }
+        return;
+    } else if (command.find("lz-loadtree") == 0) {
+        std::istringstream cmdstream(command);
+        std::string tmp, filename;
+
+        // tmp will eat lz-loadtree
+        cmdstream >> tmp >> filename;
+
+        if (cmdstream.fail()) {
+            gtp_fail_printf(id, "syntax not understood");
+        } else if (search->load_tree(filename)) {
+            gtp_printf(id, "");
+        } else {
+            gtp_fail_printf(id, "cannot load tree");
+        }
+        return;
     } else if (command.find("lz-setoption") == 0) {
         return execute_setoption(*search.get(), id, command);
     } else if (command.find("gomill-explain_last_move") == 0) {
@@ -1376,6 +1525,26 @@ void GTP::execute_setoption(UCTSearch & search,
         // we will stick with the initial guess we made on startup.
         search.set_playout_limit(cfg_max_playouts);
 
+        gtp_printf(id, "");
+    } else if (name == "book depth") {
+        std::istringstream valuestream(value);
+        int depth;
+        valuestream >> depth;
+        if (valuestream.fail() || depth < 0) {
+            gtp_fail_printf(id, "incorrect value");
+            return;
+        }
+        cfg_book_depth = depth;
+        gtp_printf(id, "");
+    } else if (name == "book min visits") {
+        std::istringstream valuestream(value);
+        int visits;
+        valuestream >> visits;
+        if (valuestream.fail() || visits < 1) {
+            gtp_fail_printf(id, "incorrect value");
+            return;
+        }
+        cfg_book_min_visits = visits;
         gtp_printf(id, "");
     } else if (name == "lagbuffer") {
         std::istringstream valuestream(value);
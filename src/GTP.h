@@ -38,6 +38,7 @@
 
 #include "Network.h"
 #include "GameState.h"
+#include "OpeningBook.h"
 #include "UCTSearch.h"
 
 struct MoveToAvoid {
@@ -95,8 +96,30 @@ extern int cfg_noise;
 extern int cfg_random_cnt;
 extern int cfg_random_min_visits;
 extern float cfg_random_temp;
+extern int cfg_fast_visits;
+extern float cfg_full_search_prob;
+extern int cfg_selfplay_games;
+extern std::string cfg_server;
+extern int cfg_server_searches;
 extern std::uint64_t cfg_rng_seed;
 extern bool cfg_dumbpass;
+extern int cfg_threat_nodes;
+extern int cfg_threat_depth;
+extern bool cfg_eval_forced;
+extern bool cfg_transpositions;
+extern bool cfg_striping;
+extern int cfg_leaf_batch;
+extern int cfg_async_sims;
+extern int cfg_eval_threads;
+extern bool cfg_recycle_tree;
+extern int cfg_root_groups;
+extern int cfg_ponder_replies;
+extern bool cfg_gumbel;
+extern int cfg_gumbel_m;
+extern std::string cfg_book_file;
+extern std::string cfg_book_sgf;
+extern int cfg_book_depth;
+extern int cfg_book_min_visits;
 #ifdef USE_OPENCL
 extern std::vector<int> cfg_gpus;
 extern bool cfg_sgemm_exhaustive;
@@ -123,7 +146,8 @@ extern bool cfg_quiet;
 extern std::string cfg_options_str;
 extern bool cfg_benchmark;
 extern bool cfg_cpu_only;
-extern AnalyzeTags cfg_analyze_tags;
+// Per thread, so every game of the GTPServer analyzes on its own.
+extern thread_local AnalyzeTags cfg_analyze_tags;
 
 static constexpr size_t MiB = 1024LL * 1024LL;
 
@@ -135,8 +159,12 @@ static constexpr size_t MiB = 1024LL * 1024LL;
 class GTP {
 public:
     static std::unique_ptr<Network> s_network;
+    static std::unique_ptr<OpeningBook> s_book;
     static void initialize(std::unique_ptr<Network>&& network);
     static void execute(GameState & game, const std::string& xinput);
+    // For one of several games, search is the one of game.
+    static void execute(GameState & game, std::unique_ptr<UCTSearch>& search,
+                        const std::string& xinput);
     static void setup_default_parameters();
 private:
     static constexpr int GTP_VERSION = 2;
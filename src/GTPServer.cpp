@@ -0,0 +1,245 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include "config.h"
+#include "GTPServer.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <thread>
+
+#ifndef _WIN32
+#include <csignal>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#include "GTP.h"
+#include "Utils.h"
+
+using namespace Utils;
+
+GTPServer::Session::Session() {
+    game.init_game(BOARD_SIZE);
+    search = std::make_unique<UCTSearch>(game, *GTP::s_network);
+}
+
+GTPServer::GTPServer()
+    : m_free_turns(std::max(1, cfg_server_searches)) {}
+
+int GTPServer::parse_port(const std::string& address) {
+    const auto is_number = !address.empty()
+        && std::all_of(begin(address), end(address),
+                       [](char c) { return std::isdigit(c); });
+    if (!is_number) {
+        return 0;
+    }
+    // Short enough for stoi.
+    if (address.size() > 5) {
+        return -1;
+    }
+    const auto port = std::stoi(address);
+    return port >= 1 && port <= 65535 ? port : -1;
+}
+
+bool GTPServer::run(const std::string& address) {
+#ifdef _WIN32
+    myprintf_error("--server needs POSIX sockets.\n");
+    (void)address;
+    return false;
+#else
+    const auto port = parse_port(address);
+    if (port < 0) {
+        myprintf_error("Port %s is out of range, use 1 to 65535.\n",
+                       address.c_str());
+        return false;
+    }
+    auto fd = -1;
+    auto bound = false;
+    if (port > 0) {
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        auto reuse = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        auto addr = sockaddr_in{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = htons(port);
+        bound = fd >= 0 && bind(fd, reinterpret_cast<sockaddr*>(&addr),
+                                sizeof(addr)) == 0;
+    } else {
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        auto addr = sockaddr_un{};
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, address.c_str(),
+                     sizeof(addr.sun_path) - 1);
+        unlink(address.c_str());
+        bound = fd >= 0 && bind(fd, reinterpret_cast<sockaddr*>(&addr),
+                                sizeof(addr)) == 0;
+    }
+    if (!bound || listen(fd, 16) != 0) {
+        myprintf_error("Can't listen on %s.\n", address.c_str());
+        if (fd >= 0) {
+            close(fd);
+        }
+        return false;
+    }
+    // A client that went away fails the write instead of killing us.
+    signal(SIGPIPE, SIG_IGN);
+    myprintf_error("Serving GTP on %s.\n", address.c_str());
+
+    for (;;) {
+        const auto client = accept(fd, nullptr, nullptr);
+        if (client < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        std::thread([this, client]{ serve(client); }).detach();
+    }
+    close(fd);
+    return true;
+#endif
+}
+
+void GTPServer::serve(int fd) {
+#ifndef _WIN32
+    const auto out = fdopen(dup(fd), "w");
+    if (!out) {
+        close(fd);
+        return;
+    }
+    set_gtp_streams(out, fd);
+
+    auto session = std::make_shared<Session>();
+    auto session_name = std::string{};
+    auto line = std::string{};
+    char c;
+    // One byte at a time, so input_pending() sees what we didn't read yet.
+    while (recv(fd, &c, 1, 0) == 1) {
+        if (c != '\n') {
+            if (c != '\r') {
+                line += c;
+            }
+            continue;
+        }
+        log_input(line);
+
+        auto id = -1;
+        auto command = std::string{};
+        {
+            std::istringstream strm(line);
+            if (!line.empty() && std::isdigit(line[0])) {
+                strm >> id;
+            }
+            std::getline(strm >> std::ws, command);
+            std::transform(begin(command), end(command), begin(command),
+                           [](char ch) { return std::tolower(ch); });
+        }
+        std::istringstream cmdstream(command);
+        auto word = std::string{};
+        auto name = std::string{};
+        cmdstream >> word >> name;
+
+        if (word == "quit" || word == "exit") {
+            gtp_printf(id, "");
+            break;
+        } else if (word == "lz-session") {
+            if (name.empty()) {
+                gtp_printf(id, "%s", session_name.c_str());
+            } else {
+                session = open_session(name);
+                session_name = name;
+                gtp_printf(id, "");
+            }
+        } else if (word == "lz-closesession") {
+            if (close_session(name)) {
+                gtp_printf(id, "");
+            } else {
+                gtp_fail_printf(id, "unknown session");
+            }
+        } else {
+            std::lock_guard<std::mutex> lock(session->mutex);
+            acquire_turn();
+            GTP::execute(session->game, session->search, line);
+            release_turn();
+        }
+        line.clear();
+    }
+
+    set_gtp_streams(nullptr, 0);
+    fclose(out);
+    close(fd);
+#else
+    (void)fd;
+#endif
+}
+
+std::shared_ptr<GTPServer::Session> GTPServer::open_session(
+    const std::string& name) {
+    std::lock_guard<std::mutex> lock(m_sessions_mutex);
+    auto& session = m_sessions[name];
+    if (!session) {
+        session = std::make_shared<Session>();
+    }
+    return session;
+}
+
+bool GTPServer::close_session(const std::string& name) {
+    std::lock_guard<std::mutex> lock(m_sessions_mutex);
+    // Connections still on it keep it until they leave.
+    return m_sessions.erase(name) > 0;
+}
+
+void GTPServer::acquire_turn() {
+    std::unique_lock<std::mutex> lock(m_turn_mutex);
+    const auto ticket = m_next_ticket++;
+    m_turn_condvar.wait(lock, [&]{
+        return ticket == m_serving && m_free_turns > 0;
+    });
+    m_serving++;
+    m_free_turns--;
+    lock.unlock();
+    // The next in line may have a free turn too.
+    m_turn_condvar.notify_all();
+}
+
+void GTPServer::release_turn() {
+    {
+        std::lock_guard<std::mutex> lock(m_turn_mutex);
+        m_free_turns++;
+    }
+    m_turn_condvar.notify_all();
+}
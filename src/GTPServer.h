@@ -0,0 +1,98 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#ifndef GTPSERVER_H_INCLUDED
+#define GTPSERVER_H_INCLUDED
+
+#include "config.h"
+
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "GameState.h"
+#include "UCTSearch.h"
+
+/*
+    GTP for many games at once, on a local socket. Every game is a session
+    with its own GameState and UCTSearch, all of them use the one network,
+    NNCache and thread pool of the process.
+
+    A connection starts on a session of its own, which ends with it.
+    lz-session <id> moves the connection to the named session <id>, made
+    if it is new. Named sessions outlive their connections, so a client
+    can come back to its game, until lz-closesession <id>. quit closes
+    the connection and leaves the server running.
+
+    At most cfg_server_searches commands run at once, the others wait for
+    their turn in the order they came in.
+*/
+class GTPServer {
+public:
+    GTPServer();
+
+    // A port number listens on localhost, anything else on a Unix socket
+    // of that name. Returns false when the socket can't be set up.
+    bool run(const std::string& address);
+
+    // The port address names, 0 if it is a Unix socket name and -1 if it
+    // is a number but no valid port.
+    static int parse_port(const std::string& address);
+
+private:
+    struct Session {
+        Session();
+        GameState game;
+        std::unique_ptr<UCTSearch> search;
+        // One command of a session at a time.
+        std::mutex mutex;
+    };
+
+    /// 一个连接一个线程, 读到断开为止
+    void serve(int fd);
+    std::shared_ptr<Session> open_session(const std::string& name);
+    bool close_session(const std::string& name);
+
+    void acquire_turn();
+    void release_turn();
+
+    std::mutex m_sessions_mutex;
+    std::map<std::string, std::shared_ptr<Session>> m_sessions;
+
+    // First come, first served turns to run a command.
+    std::mutex m_turn_mutex;
+    std::condition_variable m_turn_condvar;
+    unsigned int m_next_ticket{0};
+    unsigned int m_serving{0};
+    int m_free_turns;
+};
+
+#endif
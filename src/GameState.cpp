@@ -191,7 +191,3 @@ const FullBoard& GameState::get_past_board(int moves_ago) const {
 const std::vector<std::shared_ptr<const KoState>>& GameState::get_game_history() const {
     return game_history;
 }
-
-bool GameState::has_end() const {
-    return board.game_end();
-}
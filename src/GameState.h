@@ -74,7 +74,6 @@ public:
     void display_state();
     bool has_resigned() const;
     int who_resigned() const;
-    bool has_end() const;
 
 private:
     std::vector<std::shared_ptr<const KoState>> game_history;
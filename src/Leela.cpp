@@ -40,12 +40,21 @@
 #include <memory>
 #include <string>
 #include <vector>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
 
+#include "FastBoard.h"
 #include "GTP.h"
+#include "GTPServer.h"
 #include "GameState.h"
 #include "Network.h"
 #include "NNCache.h"
+#include "OpeningBook.h"
 #include "Random.h"
+#include "SelfPlay.h"
 #include "ThreadPool.h"
 #include "Utils.h"
 #include "Zobrist.h"
@@ -121,7 +130,8 @@ static void calculate_thread_count_gpu(boost::program_options::variables_map & v
         cfg_num_threads = std::min(cfg_max_threads, cfg_batch_size * gpu_count * 2);
     }
 
-    if (cfg_num_threads < cfg_batch_size) {
+    // With --async the evaluator threads fill the batches instead.
+    if (cfg_num_threads < cfg_batch_size && vm["async"].as<int>() == 0) {
         printf("Number of threads = %d must be no smaller than batch size = %d\n", cfg_num_threads, cfg_batch_size);
         exit(EXIT_FAILURE);
     }
@@ -130,6 +140,30 @@ static void calculate_thread_count_gpu(boost::program_options::variables_map & v
 }
 #endif
 
+// Another board size is handed over to the leelaz-<size> build installed
+// next to this binary, see BOARD_SIZES in CMakeLists.txt.
+static void dispatch_board_size(int size, char *argv[]) {
+    if (size == BOARD_SIZE) {
+        return;
+    }
+    auto exe = boost::filesystem::path(argv[0]).parent_path()
+               / ("leelaz-" + std::to_string(size));
+#ifdef _WIN32
+    exe += ".exe";
+    if (boost::filesystem::exists(exe)) {
+        _execv(exe.string().c_str(), argv);
+    }
+#else
+    if (boost::filesystem::exists(exe)) {
+        execv(exe.string().c_str(), argv);
+    }
+#endif
+    printf("This binary was built for %dx%d boards, and there is no %s.\n",
+           BOARD_SIZE, BOARD_SIZE, exe.string().c_str());
+    printf("Build leelaz-%d with BOARD_SIZES or LEELAZ_BOARD_SIZE=%d.\n", size, size);
+    exit(EXIT_FAILURE);
+}
+
 static void parse_commandline(int argc, char *argv[]) {
     namespace po = boost::program_options;
     // Declare the supported options.
@@ -137,6 +171,12 @@ static void parse_commandline(int argc, char *argv[]) {
     gen_desc.add_options()
         ("help,h", "Show commandline options.")
         ("gtp,g", "Enable GTP mode.")
+        ("server", po::value<std::string>(),
+                   "Serve GTP for many games at once on this localhost "
+                   "port, or on a Unix socket of this name.")
+        ("serversearches",
+            po::value<int>()->default_value(cfg_server_searches),
+            "Commands --server runs at once, the others wait their turn.")
         ("threads,t", po::value<unsigned int>()->default_value(0),
                       "Number of threads to use. Select 0 to let leela-zero pick a reasonable default.")
         ("playouts,p", po::value<int>(),
@@ -150,6 +190,9 @@ static void parse_commandline(int argc, char *argv[]) {
                         "Resign when winrate is less than x%.\n"
                         "-1 uses 10% but scales for handicap.")
         ("weights,w", po::value<std::string>()->default_value(cfg_weightsfile), "File with network weights.")
+        ("boardsize", po::value<int>()->default_value(BOARD_SIZE),
+                      "Board size the weights are for. Other sizes than "
+                      "this build's run the leelaz-<size> build next to it.")
         ("logfile,l", po::value<std::string>(), "File to log input/output to.")
         ("quiet,q", "Disable all diagnostic output.")
         ("timemanage", po::value<std::string>()->default_value("auto"),
@@ -160,6 +203,54 @@ static void parse_commandline(int argc, char *argv[]) {
                        "fast = Same as on but always plays faster.\n"
                        "no_pruning = For self play training use.\n")
         ("noponder", "Disable thinking on opponent's time.")
+        ("threatnodes", po::value<int>()->default_value(cfg_threat_nodes),
+                        "Node budget of the VCF/VCT solver run on new search "
+                        "nodes, e.g. 500. 0 (the default) disables it.")
+        ("threatdepth", po::value<int>()->default_value(cfg_threat_depth),
+                        "Live three threats the solver may use in a line, "
+                        "0 only looks for VCF.")
+        ("evalforced", "Evaluate positions with a single forced block with "
+                       "the network too.")
+        ("transpositions", "Share search nodes between move orders that reach "
+                           "the same position. The network then sees the "
+                           "move history of whichever order got there first.")
+        ("nostriping", "Keep the stats of the root and its children in one "
+                       "place instead of one stripe per thread.")
+        ("leafbatch", po::value<int>()->default_value(cfg_leaf_batch),
+                      "Leaves every search thread collects before it "
+                      "evaluates them as one network batch. With --async, "
+                      "the largest batch of the evaluator.")
+        ("async", po::value<int>()->default_value(cfg_async_sims),
+                  "Simulations every search thread keeps waiting on the "
+                  "network evaluator while it goes on searching. "
+                  "0 makes every thread wait for its own evals.")
+        ("evalthreads", po::value<int>()->default_value(cfg_eval_threads),
+                        "Threads of the evaluator used by --async.")
+        ("recycle", "Keep searching when the tree fills the memory budget, "
+                    "dropping the subtrees of rarely visited moves off the "
+                    "principal variation. Not used with --transpositions.")
+        ("rootgroups", po::value<int>()->default_value(cfg_root_groups),
+                       "Independent trees the threads are split into, each "
+                       "on its own NUMA node if there are several. Their "
+                       "root moves are merged while they search.")
+        ("ponderreplies", po::value<int>()->default_value(cfg_ponder_replies),
+                          "Opponent replies pondering is spread over, by "
+                          "their share of the visits. 0 ponders like a "
+                          "normal search.")
+        ("gumbel", "Pick the root moves by Gumbel sampling and sequential "
+                   "halving instead of noise and PUCT, and train on the "
+                   "improved policy. Needs a visit or playout limit.")
+        ("gumbelm", po::value<int>()->default_value(cfg_gumbel_m),
+                    "Root moves sampled by --gumbel.")
+        ("book", po::value<std::string>(),
+                 "Opening book to play from.")
+        ("buildbook", po::value<std::string>(),
+                      "Write the --book file from the first --bookdepth "
+                      "moves of the games in this SGF file and exit.")
+        ("bookdepth", po::value<int>()->default_value(cfg_book_depth),
+                      "Only use the book for the first x moves.")
+        ("bookvisits", po::value<int>()->default_value(cfg_book_min_visits),
+                       "Minimum number of games a book move needs.")
         ("benchmark", "Test network and exit. Default args:\n-v3200 --noponder "
                       "-m0 -t1 -s1.")
 #ifndef USE_CPU_ONLY
@@ -195,6 +286,16 @@ static void parse_commandline(int argc, char *argv[]) {
         ("randomtemp",
             po::value<float>()->default_value(cfg_random_temp),
             "Temperature to use for random move selection.")
+        ("fastvisits", po::value<int>()->default_value(cfg_fast_visits),
+                       "Play most moves with this many visits and no policy target.\n"
+                       "0 gives every move the full search.")
+        ("fullprob",
+            po::value<float>()->default_value(cfg_full_search_prob),
+            "Fraction of moves that get the full search with --fastvisits.")
+        ("selfplay", po::value<int>()->default_value(cfg_selfplay_games),
+                     "Games to play at once, each with --threads search "
+                     "threads. Their searches share one evaluator, "
+                     "see --async.")
         ;
 #ifdef USE_TUNER
     po::options_description tuner_desc("Tuning options");
@@ -261,6 +362,8 @@ static void parse_commandline(int argc, char *argv[]) {
         exit(ev);
     }
 
+    dispatch_board_size(vm["boardsize"].as<int>(), argv);
+
     if (vm.count("quiet")) {
         cfg_quiet = true;
     }
@@ -307,6 +410,15 @@ static void parse_commandline(int argc, char *argv[]) {
         cfg_gtp_mode = true;
     }
 
+    if (vm.count("server")) {
+        cfg_server = vm["server"].as<std::string>();
+        cfg_gtp_mode = true;
+    }
+
+    if (vm.count("serversearches")) {
+        cfg_server_searches = std::max(1, vm["serversearches"].as<int>());
+    }
+
 #ifdef USE_OPENCL
     if (vm.count("gpu")) {
         cfg_gpus = vm["gpu"].as<std::vector<int> >();
@@ -373,7 +485,9 @@ static void parse_commandline(int argc, char *argv[]) {
     }
     myprintf("RNG seed: %llu\n", cfg_rng_seed);
 
-    if (vm.count("noponder")) {
+    // A pondering game would keep its turn of the server until the next
+    // command of its client.
+    if (vm.count("noponder") || !cfg_server.empty()) {
         cfg_allow_pondering = false;
     }
 
@@ -409,6 +523,78 @@ static void parse_commandline(int argc, char *argv[]) {
         }
     }
 
+    if (vm.count("threatnodes")) {
+        cfg_threat_nodes = vm["threatnodes"].as<int>();
+    }
+
+    if (vm.count("threatdepth")) {
+        cfg_threat_depth = vm["threatdepth"].as<int>();
+    }
+
+    if (vm.count("evalforced")) {
+        cfg_eval_forced = true;
+    }
+
+    if (vm.count("transpositions")) {
+        cfg_transpositions = true;
+    }
+
+    if (vm.count("nostriping")) {
+        cfg_striping = false;
+    }
+
+    if (vm.count("leafbatch")) {
+        cfg_leaf_batch = std::max(1, vm["leafbatch"].as<int>());
+    }
+
+    if (vm.count("async")) {
+        cfg_async_sims = std::max(0, vm["async"].as<int>());
+    }
+
+    if (vm.count("evalthreads")) {
+        cfg_eval_threads = std::max(1, vm["evalthreads"].as<int>());
+    }
+
+    if (vm.count("recycle")) {
+        cfg_recycle_tree = true;
+    }
+
+    if (vm.count("rootgroups")) {
+        cfg_root_groups = std::max(1, vm["rootgroups"].as<int>());
+    }
+
+    if (vm.count("ponderreplies")) {
+        cfg_ponder_replies = std::max(0, vm["ponderreplies"].as<int>());
+    }
+
+    if (vm.count("gumbel")) {
+        cfg_gumbel = true;
+    }
+
+    if (vm.count("gumbelm")) {
+        cfg_gumbel_m = std::max(1, vm["gumbelm"].as<int>());
+    }
+
+    if (vm.count("book")) {
+        cfg_book_file = vm["book"].as<std::string>();
+    }
+
+    if (vm.count("buildbook")) {
+        if (!vm.count("book")) {
+            printf("--buildbook needs the book file to write with --book.\n");
+            exit(EXIT_FAILURE);
+        }
+        cfg_book_sgf = vm["buildbook"].as<std::string>();
+    }
+
+    if (vm.count("bookdepth")) {
+        cfg_book_depth = vm["bookdepth"].as<int>();
+    }
+
+    if (vm.count("bookvisits")) {
+        cfg_book_min_visits = vm["bookvisits"].as<int>();
+    }
+
     if (vm.count("resignpct")) {
         cfg_resignpct = vm["resignpct"].as<int>();
     }
@@ -425,6 +611,25 @@ static void parse_commandline(int argc, char *argv[]) {
         cfg_random_temp = vm["randomtemp"].as<float>();
     }
 
+    if (vm.count("fastvisits")) {
+        cfg_fast_visits = std::max(0, vm["fastvisits"].as<int>());
+    }
+
+    if (vm.count("fullprob")) {
+        cfg_full_search_prob = vm["fullprob"].as<float>();
+    }
+
+    if (vm.count("selfplay")) {
+        cfg_selfplay_games = std::max(1, vm["selfplay"].as<int>());
+        // The games only batch their evals together through --async.
+        if (cfg_selfplay_games > 1 && cfg_async_sims == 0) {
+            cfg_async_sims = 4;
+        }
+        if (cfg_selfplay_games > 1 && vm["leafbatch"].defaulted()) {
+            cfg_leaf_batch = cfg_selfplay_games * cfg_async_sims;
+        }
+    }
+
     if (vm.count("timemanage")) {
         auto tm = vm["timemanage"].as<std::string>();
         if (tm == "auto") {
@@ -493,12 +698,17 @@ static void initialize_network() {
 
 // Setup global objects after command line has been parsed
 void init_global_objects() {
-    thread_pool.initialize(cfg_num_threads);
+    // Every self-play game or server turn searches with its own threads.
+    const auto searches = cfg_server.empty() ? cfg_selfplay_games
+                                             : cfg_server_searches;
+    thread_pool.initialize(cfg_num_threads * searches);
 
     // Use deterministic random numbers for hashing
     auto rng = std::make_unique<Random>(5489);
     Zobrist::init_zobrist(*rng);
 
+    FastBoard::init_patterns();
+
     // Initialize the main thread RNG.
     // Doing this here avoids mixing in the thread_id, which
     // improves reproducibility across platforms.
@@ -507,6 +717,15 @@ void init_global_objects() {
     Utils::create_z_table();
 
     initialize_network();
+
+    if (!cfg_book_file.empty() && cfg_book_sgf.empty()) {
+        GTP::s_book = std::make_unique<OpeningBook>();
+        if (!GTP::s_book->load(cfg_book_file)) {
+            exit(EXIT_FAILURE);
+        }
+        myprintf("Loaded opening book with %zu entries.\n",
+                 GTP::s_book->size());
+    }
 }
 
 void benchmark(GameState& game) {
@@ -520,40 +739,6 @@ void benchmark(GameState& game) {
     search->think(FastBoard::WHITE);
 }
 
-void selfplay(GameState & maingame, int num_games)
-{
-    for (int i = 0; i < num_games; i++) {
-        static auto search = std::make_unique<UCTSearch>(maingame, *GTP::s_network);
-        do {
-            int move = search->think(maingame.get_to_move(), UCTSearch::NORMAL);
-            maingame.play_move(move);
-            maingame.display_state();
-
-        } while (!maingame.has_end() && !maingame.has_resigned());
-        std::string filename("traindata");
-        float ftmp = maingame.final_score();
-        auto who_won = FullBoard::INVAL;
-        /* white wins */
-        int id = -1;
-        if (ftmp < -0.1) {
-            gtp_printf(id, "W+%3.1f", float(fabs(ftmp)));
-            who_won = FullBoard::WHITE;
-        } else if (ftmp > 0.1) {
-            gtp_printf(id, "B+%3.1f", ftmp);
-            who_won = FullBoard::BLACK;
-        } else {
-            gtp_printf(id, "0");
-            who_won = FullBoard::EMPTY;
-        }
-        Training::dump_training(who_won, filename + (std::to_string(i)));
-        Training::clear_training();
-        maingame.reset_game();
-        search = std::make_unique<UCTSearch>(maingame, *GTP::s_network);
-        assert(UCTNodePointer::get_tree_size() == 0);
-        gtp_printf(id, "");
-    }
-}
-
 int main(int argc, char *argv[]) {
     // Set up engine parameters
     GTP::setup_default_parameters();
@@ -587,8 +772,18 @@ int main(int argc, char *argv[]) {
         return 0;
     }
 
+    if (!cfg_book_sgf.empty()) {
+        auto built = OpeningBook::build(cfg_book_sgf, cfg_book_file,
+                                        cfg_book_depth);
+        return built ? 0 : 1;
+    }
+
+
+    if (!cfg_server.empty()) {
+        return GTPServer().run(cfg_server) ? 0 : 1;
+    }
 
-    selfplay(*maingame, 10);
+    SelfPlay(*GTP::s_network, cfg_selfplay_games).run(10, "traindata");
 //    static auto search = std::make_unique<UCTSearch>(*maingame, *GTP::s_network);
 //    do {
 //        int move = search->think(maingame->get_to_move(), UCTSearch::NORMAL);
@@ -304,7 +304,8 @@ std::pair<int, int> Network::load_v1_network(std::istream& wtfile) {
                 case  4: if (weights.size() != OUTPUTS_POLICY
                                                * NUM_INTERSECTIONS
                                                * POTENTIAL_MOVES) {
-                             myprintf("The weights file is not for %dx%d boards.\n",
+                             myprintf("The weights file is not for %dx%d boards, "
+                                      "pass its size with --boardsize.\n",
                                       BOARD_SIZE, BOARD_SIZE);
                              return {0, 0};
                          }
@@ -336,16 +337,16 @@ std::pair<int, int> Network::load_v1_network(std::istream& wtfile) {
     return {channels, static_cast<int>(residual_blocks)};
 }
 
-std::pair<int, int> Network::load_network_file(const std::string& filename) {
+static bool read_weights_file(const std::string& filename,
+                              std::stringstream& buffer) {
     // gzopen supports both gz and non-gz files, will decompress
     // or just read directly as needed.
     auto gzhandle = gzopen(filename.c_str(), "rb");
     if (gzhandle == nullptr) {
         myprintf("Could not open weights file: %s\n", filename.c_str());
-        return {0, 0};
+        return false;
     }
     // Stream the gz file in to a memory buffer stream.
-    auto buffer = std::stringstream{};
     constexpr auto chunkBufferSize = 64 * 1024;
     std::vector<char> chunkBuffer(chunkBufferSize);
     while (true) {
@@ -354,12 +355,20 @@ std::pair<int, int> Network::load_network_file(const std::string& filename) {
         if (bytesRead < 0) {
             myprintf("Failed to decompress or read: %s\n", filename.c_str());
             gzclose(gzhandle);
-            return {0, 0};
+            return false;
         }
         assert(bytesRead <= chunkBufferSize);
         buffer.write(chunkBuffer.data(), bytesRead);
     }
     gzclose(gzhandle);
+    return true;
+}
+
+std::pair<int, int> Network::load_network_file(const std::string& filename) {
+    auto buffer = std::stringstream{};
+    if (!read_weights_file(filename, buffer)) {
+        return {0, 0};
+    }
 
     // Read format version
     auto line = std::string{};
@@ -701,38 +710,57 @@ std::vector<float> softmax(const std::vector<float>& input,
     return output;
 }
 
-bool Network::probe_cache(const GameState* const state,
+template <class State>
+bool Network::probe_cache(const State* const state,
                           Network::Netresult& result) {
     if (m_nncache.lookup(state->board.get_hash(), result)) {
         return true;
     }
-    // If we are not generating a self-play game, try to find
-    // symmetries if we are in the early opening.
-    if (!cfg_noise && !cfg_random_cnt
-        && state->get_movenum()
-           < (state->get_timecontrol().opening_moves(BOARD_SIZE) / 2)) {
-        for (auto sym = 0; sym < Network::NUM_SYMMETRIES; ++sym) {
-            if (sym == Network::IDENTITY_SYMMETRY) {
-                continue;
-            }
-            const auto hash = state->get_symmetry_hash(sym);
-            if (m_nncache.lookup(hash, result)) {
-                decltype(result.policy) corrected_policy;
-                for (auto idx = size_t{0}; idx < NUM_INTERSECTIONS; ++idx) {
-                    const auto sym_idx = symmetry_nn_idx_table[sym][idx];
-                    corrected_policy[idx] = result.policy[sym_idx];
-                }
-                result.policy = std::move(corrected_policy);
-                return true;
+    // If we are not generating a self-play game, symmetric positions
+    // share the entry stored under the canonical symmetry hash.
+    if (share_symmetries()) {
+        const auto sym = state->board.get_canonical_symmetry();
+        if (sym != IDENTITY_SYMMETRY
+            && m_nncache.lookup(state->get_symmetry_hash(sym), result)) {
+            decltype(result.policy) corrected_policy;
+            for (auto idx = size_t{0}; idx < NUM_INTERSECTIONS; ++idx) {
+                const auto sym_idx = symmetry_nn_idx_table[sym][idx];
+                corrected_policy[idx] = result.policy[sym_idx];
             }
+            result.policy = std::move(corrected_policy);
+            return true;
         }
     }
 
     return false;
 }
 
+template <class State>
+void Network::insert_cache(const State* const state, const Netresult& result) {
+    const auto sym = share_symmetries()
+                     ? state->board.get_canonical_symmetry()
+                     : IDENTITY_SYMMETRY;
+    if (sym == IDENTITY_SYMMETRY) {
+        m_nncache.insert(state->board.get_hash(), result);
+        return;
+    }
+    // Store the result as seen from the canonical orientation.
+    auto canonical = result;
+    for (auto idx = size_t{0}; idx < NUM_INTERSECTIONS; ++idx) {
+        const auto sym_idx = symmetry_nn_idx_table[sym][idx];
+        canonical.policy[sym_idx] = result.policy[idx];
+    }
+    m_nncache.insert(state->get_symmetry_hash(sym), canonical);
+}
+
+bool Network::share_symmetries() const {
+    // Self-play wants every evaluation in a random symmetry.
+    return !cfg_noise && !cfg_random_cnt;
+}
+
+template <class State>
 Network::Netresult Network::get_output(
-    const GameState* const state, const Ensemble ensemble, const int symmetry,
+    const State* const state, const Ensemble ensemble, const int symmetry,
     const bool read_cache, const bool write_cache, const bool force_selfcheck) {
     Netresult result;
     if (state->board.get_boardsize() != BOARD_SIZE) {
@@ -793,14 +821,15 @@ Network::Netresult Network::get_output(
 
     if (write_cache) {
         // Insert result into cache.
-        m_nncache.insert(state->board.get_hash(), result);
+        insert_cache(state, result);
     }
 
     return result;
 }
 
+template <class State>
 Network::Netresult Network::get_output_internal(
-    const GameState* const state, const int symmetry, bool selfcheck) {
+    const State* const state, const int symmetry, bool selfcheck) {
     assert(symmetry >= 0 && symmetry < NUM_SYMMETRIES);
     constexpr auto width = BOARD_SIZE;
     constexpr auto height = BOARD_SIZE;
@@ -819,6 +848,12 @@ Network::Netresult Network::get_output_internal(
     (void) selfcheck;
 #endif
 
+    return get_output_from_heads(policy_data, value_data, symmetry);
+}
+
+Network::Netresult Network::get_output_from_heads(
+    std::vector<float>& policy_data, std::vector<float>& value_data,
+    const int symmetry) {
     // Get the moves
     batchnorm<NUM_INTERSECTIONS>(OUTPUTS_POLICY, policy_data,
         m_bn_pol_w1.data(), m_bn_pol_w2.data());
@@ -853,17 +888,68 @@ Network::Netresult Network::get_output_internal(
     return result;
 }
 
+template <class State>
+std::vector<Network::Netresult> Network::get_output_batch(
+    const std::vector<const State*>& states) {
+    auto results = std::vector<Netresult>(states.size());
+
+    auto pending = std::vector<size_t>{};
+    auto symmetries = std::vector<int>{};
+    auto input_data = std::vector<float>{};
+    for (auto i = size_t{0}; i < states.size(); i++) {
+        const auto state = states[i];
+        if (state->board.get_boardsize() != BOARD_SIZE
+            || probe_cache(state, results[i])) {
+            continue;
+        }
+        const auto symmetry = Random::get_Rng().randfix<NUM_SYMMETRIES>();
+        const auto features = gather_features(state, symmetry);
+        input_data.insert(end(input_data), begin(features), end(features));
+        pending.emplace_back(i);
+        symmetries.emplace_back(symmetry);
+    }
+    if (pending.empty()) {
+        return results;
+    }
+
+    constexpr auto policy_size = OUTPUTS_POLICY * NUM_INTERSECTIONS;
+    constexpr auto value_size = OUTPUTS_VALUE * NUM_INTERSECTIONS;
+    const auto batch_size = static_cast<int>(pending.size());
+    std::vector<float> policy_data(batch_size * policy_size);
+    std::vector<float> value_data(batch_size * value_size);
+    m_forward->forward_batch(input_data, batch_size, policy_data, value_data);
+
+    std::vector<float> policy(policy_size);
+    std::vector<float> value(value_size);
+    for (auto i = 0; i < batch_size; i++) {
+        std::copy_n(begin(policy_data) + i * policy_size, policy_size,
+                    begin(policy));
+        std::copy_n(begin(value_data) + i * value_size, value_size,
+                    begin(value));
+        const auto state = states[pending[i]];
+        auto& result = results[pending[i]];
+        result = get_output_from_heads(policy, value, symmetries[i]);
+        // v2 format (ELF Open Go) returns black value, not stm
+        if (m_value_head_not_stm
+            && state->board.get_to_move() == FastBoard::WHITE) {
+            result.winrate = 1.0f - result.winrate;
+        }
+        insert_cache(state, result);
+    }
+    return results;
+}
+
 void Network::show_heatmap(const FastState* const state,
                            const Netresult& result,
                            const bool topmoves) {
     std::vector<std::string> display_map;
     std::string line;
+    const auto& legal = state->get_legal_mask(state->get_to_move());
 
     for (unsigned int y = 0; y < BOARD_SIZE; y++) {
         for (unsigned int x = 0; x < BOARD_SIZE; x++) {
             auto policy = 0;
-            const auto vertex = state->board.get_vertex(x, y);
-            if (state->board.get_state(vertex) == FastBoard::EMPTY) {
+            if (legal[y * BOARD_SIZE + x]) {
                 policy = result.policy[y * BOARD_SIZE + x] * 1000;
             }
 
@@ -886,8 +972,8 @@ void Network::show_heatmap(const FastState* const state,
         for (auto i=0; i < NUM_INTERSECTIONS; i++) {
             const auto x = i % BOARD_SIZE;
             const auto y = i / BOARD_SIZE;
-            const auto vertex = state->board.get_vertex(x, y);
-            if (state->board.get_state(vertex) == FastBoard::EMPTY) {
+            if (legal[i]) {
+                const auto vertex = state->board.get_vertex(x, y);
                 moves.emplace_back(result.policy[i], vertex);
             }
         }
@@ -923,7 +1009,8 @@ void Network::fill_input_plane_pair(const FullBoard& board,
     }
 }
 
-std::vector<float> Network::gather_features(const GameState* const state,
+template <class State>
+std::vector<float> Network::gather_features(const State* const state,
                                             const int symmetry) {
     assert(symmetry >= 0 && symmetry < NUM_SYMMETRIES);
     auto input_data = std::vector<float>(INPUT_CHANNELS * NUM_INTERSECTIONS);
@@ -956,6 +1043,19 @@ std::vector<float> Network::gather_features(const GameState* const state,
     return input_data;
 }
 
+template Network::Netresult Network::get_output<GameState>(
+    const GameState* const, const Ensemble, const int,
+    const bool, const bool, const bool);
+template Network::Netresult Network::get_output<SearchState>(
+    const SearchState* const, const Ensemble, const int,
+    const bool, const bool, const bool);
+template std::vector<Network::Netresult> Network::get_output_batch<SearchState>(
+    const std::vector<const SearchState*>&);
+template std::vector<float> Network::gather_features<GameState>(
+    const GameState* const, const int);
+template std::vector<float> Network::gather_features<SearchState>(
+    const SearchState* const, const int);
+
 // 轴对称/中心对称棋盘
 std::pair<int, int> Network::get_symmetry(const std::pair<int, int>& vertex,
                                           const int symmetry,
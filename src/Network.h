@@ -46,6 +46,7 @@
 #include "OpenCLScheduler.h"
 #endif
 #include "GameState.h"
+#include "SearchState.h"
 #include "ForwardPipe.h"
 #ifdef USE_OPENCL
 #include "OpenCLScheduler.h"
@@ -69,7 +70,7 @@ class NetworkHaltException : public std::exception {};
 class Network {
     using ForwardPipeWeights = ForwardPipe::ForwardPipeWeights;
 public:
-    static constexpr auto NUM_SYMMETRIES = 8;
+    static constexpr auto NUM_SYMMETRIES = FullBoard::NUM_SYMMETRIES;
     static constexpr auto IDENTITY_SYMMETRY = 0;
     enum Ensemble {
         DIRECT, RANDOM_SYMMETRY, AVERAGE
@@ -77,12 +78,18 @@ public:
     using PolicyVertexPair = std::pair<float,int>;
     using Netresult = NNCache::Netresult;
 
-    Netresult get_output(const GameState* const state,
+    /// State is GameState, or SearchState inside the tree search
+    template <class State>
+    Netresult get_output(const State* const state,
                          const Ensemble ensemble,
                          const int symmetry = -1,
                          const bool read_cache = true,
                          const bool write_cache = true,
                          const bool force_selfcheck = false);
+    /// 一次前向算一批局面, 每个局面随机取一个对称, 缓存的读写和get_output一样
+    template <class State>
+    std::vector<Netresult> get_output_batch(
+        const std::vector<const State*>& states);
 
     static constexpr auto INPUT_MOVES = LAYER_INPUT_MOVES;
     static constexpr auto INPUT_CHANNELS = 2 * INPUT_MOVES + 2;
@@ -98,7 +105,8 @@ public:
     static void show_heatmap(const FastState * const state,
                              const Netresult & netres, const bool topmoves);
 
-    static std::vector<float> gather_features(const GameState* const state,
+    template <class State>
+    static std::vector<float> gather_features(const State* const state,
                                               const int symmetry);
     static std::pair<int, int> get_symmetry(const std::pair<int, int>& vertex,
                                             const int symmetry,
@@ -140,13 +148,21 @@ private:
     static void winograd_sgemm(const std::vector<float>& U,
                                const std::vector<float>& V,
                                std::vector<float>& M, const int C, const int K);
-    Netresult get_output_internal(const GameState* const state,
+    template <class State>
+    Netresult get_output_internal(const State* const state,
                                   const int symmetry, bool selfcheck = false);
+    Netresult get_output_from_heads(std::vector<float>& policy_data,
+                                    std::vector<float>& value_data,
+                                    const int symmetry);
     static void fill_input_plane_pair(const FullBoard& board,
                                       std::vector<float>::iterator black,
                                       std::vector<float>::iterator white,
                                       const int symmetry);
-    bool probe_cache(const GameState* const state, Network::Netresult& result);
+    template <class State>
+    bool probe_cache(const State* const state, Network::Netresult& result);
+    template <class State>
+    void insert_cache(const State* const state, const Netresult& result);
+    bool share_symmetries() const;
     std::unique_ptr<ForwardPipe>&& init_net(int channels,
                                             std::unique_ptr<ForwardPipe>&& pipe);
 #ifdef USE_HALF
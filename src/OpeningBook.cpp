@@ -0,0 +1,237 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include "config.h"
+#include "OpeningBook.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <utility>
+#include <vector>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "FullBoard.h"
+#include "Network.h"
+#include "SGFParser.h"
+#include "SGFTree.h"
+#include "Utils.h"
+
+using namespace Utils;
+
+static constexpr char BOOK_MAGIC[8] = {'L', 'Z', 'G', 'B', 'O', 'O', 'K', '1'};
+
+static_assert(sizeof(OpeningBook::Entry) == 24,
+              "book entries are read straight from the file");
+
+OpeningBook::OpeningBook() = default;
+OpeningBook::~OpeningBook() = default;
+
+std::uint16_t OpeningBook::to_canonical(const FullBoard& board, int vertex) {
+    const auto size = board.get_boardsize();
+    const auto xy = board.get_xy(vertex);
+    const auto canonical = board.get_symmetry_hash(board.get_canonical_symmetry());
+    auto best = std::uint16_t(NUM_INTERSECTIONS);
+    for (auto sym = 0; sym < FullBoard::NUM_SYMMETRIES; sym++) {
+        if (board.get_symmetry_hash(sym) != canonical) {
+            continue;
+        }
+        const auto newxy = Network::get_symmetry(xy, sym, size);
+        const auto idx = std::uint16_t(newxy.second * size + newxy.first);
+        best = std::min(best, idx);
+    }
+    return best;
+}
+
+int OpeningBook::from_canonical(const FullBoard& board,
+                                std::uint16_t move, int symmetry) {
+    const auto size = board.get_boardsize();
+    for (auto y = 0; y < size; y++) {
+        for (auto x = 0; x < size; x++) {
+            const auto newxy = Network::get_symmetry({x, y}, symmetry, size);
+            if (newxy.second * size + newxy.first == move) {
+                return board.get_vertex(x, y);
+            }
+        }
+    }
+    return FastBoard::NO_VERTEX;
+}
+
+bool OpeningBook::build(const std::string& sgf_file,
+                        const std::string& book_file, int max_moves) {
+    // (canonical hash, canonical move) -> (games, wins for the mover)
+    auto stats = std::map<std::pair<std::uint64_t, std::uint16_t>,
+                          std::pair<std::uint32_t, std::uint32_t>>{};
+    auto games = SGFParser::chop_all(sgf_file);
+    auto used_games = size_t{0};
+
+    for (const auto& game : games) {
+        auto sgftree = std::make_unique<SGFTree>();
+        try {
+            sgftree->load_from_string(game);
+        } catch (...) {
+            continue;
+        }
+
+        const auto tree_moves = sgftree->get_mainline();
+        if (tree_moves.empty()) {
+            continue;
+        }
+        auto state = sgftree->follow_mainline_state();
+        if (state.board.get_boardsize() != BOARD_SIZE) {
+            continue;
+        }
+        const auto who_won = sgftree->get_winner();
+        state.rewind();
+        used_games++;
+
+        const auto moves = std::min(tree_moves.size(), size_t(max_moves));
+        for (auto i = size_t{0}; i < moves; i++) {
+            const auto to_move = state.get_to_move();
+            const auto move = tree_moves[i];
+            if (move == FastBoard::PASS || move == FastBoard::RESIGN
+                || !state.is_move_legal(to_move, move)) {
+                break;
+            }
+            const auto symmetry = state.board.get_canonical_symmetry();
+            const auto key = std::make_pair(
+                state.board.get_symmetry_hash(symmetry),
+                to_canonical(state.board, move));
+            auto& entry = stats[key];
+            entry.first++;
+            if (who_won == to_move) {
+                entry.second++;
+            }
+            if (!state.forward_move()) {
+                break;
+            }
+        }
+    }
+
+    std::ofstream out(book_file, std::ios::binary);
+    if (!out) {
+        myprintf("Could not open %s for writing.\n", book_file.c_str());
+        return false;
+    }
+    auto header = Header{};
+    std::memcpy(header.magic, BOOK_MAGIC, sizeof(header.magic));
+    header.board_size = BOARD_SIZE;
+    header.count = std::uint32_t(stats.size());
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    // std::map keeps the keys sorted, which is the order probe() expects.
+    for (const auto& kv : stats) {
+        auto entry = Entry{};
+        entry.hash = kv.first.first;
+        entry.move = kv.first.second;
+        entry.visits = kv.second.first;
+        entry.wins = kv.second.second;
+        out.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+    }
+    out.close();
+    if (!out) {
+        myprintf("Error writing %s.\n", book_file.c_str());
+        return false;
+    }
+
+    myprintf("Book: %zu games, %zu entries written to %s.\n",
+             used_games, stats.size(), book_file.c_str());
+    return true;
+}
+
+bool OpeningBook::load(const std::string& book_file) {
+    using namespace boost::interprocess;
+
+    m_region.reset();
+    m_file.reset();
+    m_entries = nullptr;
+    m_size = 0;
+
+    try {
+        m_file = std::make_unique<file_mapping>(book_file.c_str(), read_only);
+        m_region = std::make_unique<mapped_region>(*m_file, read_only);
+    } catch (const interprocess_exception& e) {
+        myprintf("Could not map opening book %s: %s\n",
+                 book_file.c_str(), e.what());
+        m_file.reset();
+        return false;
+    }
+
+    const auto data = static_cast<const char*>(m_region->get_address());
+    const auto bytes = m_region->get_size();
+    auto header = Header{};
+    if (bytes >= sizeof(header)) {
+        std::memcpy(&header, data, sizeof(header));
+    }
+    if (bytes < sizeof(header)
+        || std::memcmp(header.magic, BOOK_MAGIC, sizeof(header.magic)) != 0
+        || bytes != sizeof(header) + size_t(header.count) * sizeof(Entry)) {
+        myprintf("%s is not a valid opening book.\n", book_file.c_str());
+    } else if (header.board_size != BOARD_SIZE) {
+        myprintf("Opening book %s is for board size %u.\n",
+                 book_file.c_str(), header.board_size);
+    } else {
+        m_entries = reinterpret_cast<const Entry*>(data + sizeof(header));
+        m_size = header.count;
+        return true;
+    }
+    m_region.reset();
+    m_file.reset();
+    return false;
+}
+
+int OpeningBook::probe(const GameState& state, int min_visits) const {
+    if (m_size == 0) {
+        return FastBoard::NO_VERTEX;
+    }
+    const auto& board = state.board;
+    const auto symmetry = board.get_canonical_symmetry();
+    const auto hash = board.get_symmetry_hash(symmetry);
+    const auto to_move = state.get_to_move();
+
+    auto entry = std::lower_bound(m_entries, m_entries + m_size, hash,
+        [](const Entry& e, std::uint64_t h) { return e.hash < h; });
+
+    auto bestmove = int{FastBoard::NO_VERTEX};
+    auto bestvisits = std::uint32_t{0};
+    for (; entry != m_entries + m_size && entry->hash == hash; ++entry) {
+        if (entry->visits < std::uint32_t(std::max(min_visits, 1))
+            || entry->visits <= bestvisits) {
+            continue;
+        }
+        const auto vertex = from_canonical(board, entry->move, symmetry);
+        if (vertex != FastBoard::NO_VERTEX
+            && state.is_move_legal(to_move, vertex)) {
+            bestmove = vertex;
+            bestvisits = entry->visits;
+        }
+    }
+    return bestmove;
+}
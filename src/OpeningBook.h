@@ -0,0 +1,100 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#ifndef OPENINGBOOK_H_INCLUDED
+#define OPENINGBOOK_H_INCLUDED
+
+#include "config.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "GameState.h"
+
+namespace boost {
+namespace interprocess {
+class file_mapping;
+class mapped_region;
+}
+}
+
+/*
+    Opening book keyed by the canonical position hash (the smallest of
+    the 8 symmetry hashes), so transposed and mirrored openings share
+    entries. Moves are stored in the canonical orientation as well.
+
+    The file is a header followed by entries sorted by (hash, move).
+    It is memory mapped read-only, so all engines on a machine share
+    one copy of it through the page cache.
+*/
+class OpeningBook {
+public:
+    struct Entry {
+        std::uint64_t hash;
+        std::uint32_t visits;
+        /// 走这步的一方赢的局数
+        std::uint32_t wins;
+        std::uint16_t move;
+        std::uint16_t padding[3];
+    };
+
+    OpeningBook();
+    ~OpeningBook();
+
+    /// 读SGF棋谱, 把每局前max_moves步的局面和走法写成book_file
+    static bool build(const std::string& sgf_file,
+                      const std::string& book_file, int max_moves);
+
+    bool load(const std::string& book_file);
+    size_t size() const { return m_size; }
+
+    /// 返回访问数最多且不少于min_visits的合法走法, 没有就返回NO_VERTEX
+    int probe(const GameState& state, int min_visits) const;
+
+private:
+    struct Header {
+        char magic[8];
+        std::uint32_t board_size;
+        std::uint32_t count;
+    };
+
+    /// 局面本身对称时取所有规范对称下最小的编号, 等价的走法合并成一条
+    static std::uint16_t to_canonical(const FullBoard& board, int vertex);
+    static int from_canonical(const FullBoard& board,
+                              std::uint16_t move, int symmetry);
+
+    std::unique_ptr<boost::interprocess::file_mapping> m_file;
+    std::unique_ptr<boost::interprocess::mapped_region> m_region;
+    const Entry* m_entries{nullptr};
+    size_t m_size{0};
+};
+
+#endif
@@ -30,7 +30,14 @@
 #include "SMP.h"
 
 #include <cassert>
+#include <fstream>
+#include <sstream>
+#include <string>
 #include <thread>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 SMP::Mutex::Mutex() {
     m_lock = false;
@@ -76,3 +83,53 @@ SMP::Lock::~Lock() {
 size_t SMP::get_num_cpus() {
     return std::thread::hardware_concurrency();
 }
+
+std::vector<std::vector<int>> SMP::get_numa_nodes() {
+    auto nodes = std::vector<std::vector<int>>{};
+#ifdef __linux__
+    for (auto node = 0; ; node++) {
+        std::ifstream file("/sys/devices/system/node/node"
+                           + std::to_string(node) + "/cpulist");
+        if (!file) {
+            break;
+        }
+        // Ranges like "0-7,16-23"
+        auto cpus = std::vector<int>{};
+        std::string range;
+        while (std::getline(file, range, ',')) {
+            auto first = 0, last = 0;
+            auto dash = char{0};
+            std::istringstream stream(range);
+            stream >> first;
+            if (stream >> dash >> last) {
+                for (auto cpu = first; cpu <= last; cpu++) {
+                    cpus.emplace_back(cpu);
+                }
+            } else {
+                cpus.emplace_back(first);
+            }
+        }
+        nodes.emplace_back(std::move(cpus));
+    }
+#endif
+    if (nodes.empty()) {
+        nodes.emplace_back();
+    }
+    return nodes;
+}
+
+void SMP::set_thread_affinity(const std::vector<int>& cpus) {
+#ifdef __linux__
+    if (cpus.empty()) {
+        return;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const auto cpu : cpus) {
+        CPU_SET(cpu, &set);
+    }
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpus;
+#endif
+}
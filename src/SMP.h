@@ -34,9 +34,25 @@
 
 #include <cstddef>
 #include <atomic>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
 
 namespace SMP {
     size_t get_num_cpus();
+    // CPUs of every NUMA node, a single empty list if we can't tell.
+    std::vector<std::vector<int>> get_numa_nodes();
+    // Keep the calling thread on these CPUs, all of them if empty.
+    void set_thread_affinity(const std::vector<int>& cpus);
+
+    // Tell the CPU we are in a spin-wait loop.
+    inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+        _mm_pause();
+#endif
+    }
 
     class Mutex {
     public:
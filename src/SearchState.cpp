@@ -0,0 +1,125 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include "config.h"
+#include "SearchState.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "Zobrist.h"
+
+SearchState::SearchState(const GameState& root)
+    : KoState(root) {
+    auto history = std::make_shared<std::array<FullBoard, LAYER_INPUT_MOVES>>();
+    const auto moves = std::min<size_t>(root.get_movenum() + 1,
+                                        history->size());
+    for (auto h = size_t{0}; h < moves; h++) {
+        (*history)[h] = root.get_past_board(h);
+    }
+    m_root_history = std::move(history);
+    reset_history();
+    m_undo.reserve(NUM_INTERSECTIONS);
+}
+
+void SearchState::reset_history() {
+    m_newest = 0;
+    for (auto h = 0; h < LAYER_INPUT_MOVES; h++) {
+        history_slot(h) = (*m_root_history)[h];
+    }
+}
+
+FullBoard& SearchState::history_slot(int moves_ago) {
+    assert(moves_ago >= 0 && moves_ago < LAYER_INPUT_MOVES);
+    return m_history[(m_newest + LAYER_INPUT_MOVES - moves_ago)
+                     % LAYER_INPUT_MOVES];
+}
+
+void SearchState::play_move(int vertex) {
+    assert(vertex != FastBoard::RESIGN && !board.game_end());
+    m_undo.push_back({vertex, m_komove, m_lastmove, m_legal});
+    KoState::play_move(vertex);
+    m_newest = (m_newest + 1) % LAYER_INPUT_MOVES;
+    m_history[m_newest] = board;
+}
+
+void SearchState::undo_move() {
+    assert(!m_undo.empty());
+    // The board LAYER_INPUT_MOVES - 1 moves before the one we go back to
+    // takes the slot of the current one.
+    const auto oldest = int(m_undo.size()) - LAYER_INPUT_MOVES;
+    auto& slot = history_slot(0);
+    if (oldest < 0) {
+        slot = (*m_root_history)[-oldest];
+    } else {
+        slot = history_slot(LAYER_INPUT_MOVES - 1);
+        const auto vertex = m_undo[oldest].vertex;
+        const auto color = !slot.get_to_move();
+        slot.set_to_move(color);
+        if (vertex != FastBoard::PASS) {
+            slot.undo_board(color, vertex);
+        }
+    }
+    m_newest = (m_newest + LAYER_INPUT_MOVES - 1) % LAYER_INPUT_MOVES;
+    take_back();
+}
+
+void SearchState::take_back() {
+    const auto& undo = m_undo.back();
+    // FastState::play_move() backwards.
+    const auto color = !board.get_to_move();
+    board.set_to_move(color);
+    board.m_hash ^= Zobrist::zobrist_ko[m_komove];
+    if (undo.vertex != FastBoard::PASS) {
+        board.undo_board(color, undo.vertex);
+        m_legal = undo.legal;
+    }
+    m_komove = undo.komove;
+    board.m_hash ^= Zobrist::zobrist_ko[m_komove];
+    m_lastmove = undo.lastmove;
+    m_movenum--;
+    m_undo.pop_back();
+}
+
+void SearchState::rewind() {
+    if (m_undo.empty()) {
+        return;
+    }
+    while (!m_undo.empty()) {
+        take_back();
+    }
+    reset_history();
+}
+
+const FullBoard& SearchState::get_past_board(int moves_ago) const {
+    assert(moves_ago >= 0 && (unsigned)moves_ago <= m_movenum);
+    assert(moves_ago < LAYER_INPUT_MOVES);
+    return m_history[(m_newest + LAYER_INPUT_MOVES - moves_ago)
+                     % LAYER_INPUT_MOVES];
+}
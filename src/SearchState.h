@@ -27,59 +27,59 @@
     work.
 */
 
-#ifndef GAMESTATE_H_INCLUDED
-#define GAMESTATE_H_INCLUDED
+#ifndef SEARCHSTATE_H_INCLUDED
+#define SEARCHSTATE_H_INCLUDED
 
+#include "config.h"
+
+#include <array>
+#include <cstddef>
 #include <memory>
-#include <string>
 #include <vector>
 
-#include "FastState.h"
 #include "FullBoard.h"
+#include "GameState.h"
 #include "KoState.h"
-#include "TimeControl.h"
-
-class Network;
 
-class GameState : public KoState {
+/*
+    Position used while descending the search tree. Moves are played and
+    taken back in place, so a worker can reuse one object for all of its
+    simulations instead of copying the root GameState every time. Taking
+    a move back only needs what the move changed, there are no captures.
+*/
+class SearchState : public KoState {
 public:
-    explicit GameState() = default;
-    explicit GameState(const KoState* rhs) {
-        // Copy in fields from base class.
-        *(static_cast<KoState*>(this)) = *rhs;
-        anchor_game_history();
-    }
-    void init_game(int size);
-    void reset_game();
-    void anchor_game_history();
+    explicit SearchState(const GameState& root);
 
-    void rewind(); /* undo infinite */
-    bool undo_move();
-    bool forward_move();
-    const FullBoard& get_past_board(int moves_ago) const;
-    const std::vector<std::shared_ptr<const KoState>>& get_game_history() const;
-
-    void play_move(int color, int vertex);
     void play_move(int vertex);
-    bool play_textmove(std::string color, const std::string& vertex);
+    void undo_move();
+    /// 回到根节点的局面
+    void rewind();
 
-    void start_clock(int color);
-    void stop_clock(int color);
-    const TimeControl& get_timecontrol() const;
-    void set_timecontrol(const TimeControl& timecontrol);
-    void set_timecontrol(int maintime, int byotime, int byostones,
-                         int byoperiods);
-    void adjust_time(int color, int time, int stones);
-
-    void display_state();
-    bool has_resigned() const;
-    int who_resigned() const;
-    bool has_end() const;
+    const FullBoard& get_past_board(int moves_ago) const;
 
 private:
-    std::vector<std::shared_ptr<const KoState>> game_history;
-    TimeControl m_timecontrol;
-    int m_resigned{FastBoard::EMPTY};
+    /// 只动棋盘, 不管m_history
+    void take_back();
+    void reset_history();
+    FullBoard& history_slot(int moves_ago);
+
+    /// 悔棋需要的东西, 棋盘上只是拿掉那颗子
+    struct Undo {
+        int vertex;
+        int komove;
+        int lastmove;
+        std::array<movemask_t, 2> legal;
+    };
+    std::vector<Undo> m_undo;
+    /// 根节点和它之前的局面, 只留神经网络输入需要的那几个.
+    /// 拷贝SearchState的时候共用
+    std::shared_ptr<const std::array<FullBoard, LAYER_INPUT_MOVES>> m_root_history;
+    // Ring of the last LAYER_INPUT_MOVES boards, the current one in
+    // m_history[m_newest]. Playing a move overwrites the oldest, taking
+    // it back rebuilds the one that dropped out from the one after it.
+    std::array<FullBoard, LAYER_INPUT_MOVES> m_history;
+    std::size_t m_newest{0};
 };
 
 #endif
@@ -0,0 +1,142 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include "config.h"
+#include "SelfPlay.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "GTP.h"
+#include "Random.h"
+#include "Training.h"
+#include "UCTNodePointer.h"
+#include "UCTSearch.h"
+#include "Utils.h"
+
+using namespace Utils;
+
+SelfPlay::SelfPlay(Network& network, int parallel_games)
+    : m_network(network), m_parallel_games(std::max(1, parallel_games)) {
+    if (cfg_async_sims > 0 && m_parallel_games > 1) {
+        m_evaluator = std::make_shared<AsyncEvaluator>(
+            m_network, cfg_leaf_batch, cfg_eval_threads, &m_batch_stats);
+    }
+}
+
+void SelfPlay::run(int total_games, const std::string& basename) {
+    m_total_games = total_games;
+    m_next_game = 0;
+    if (m_parallel_games == 1) {
+        play_games(basename);
+    } else {
+        auto games = std::vector<std::thread>{};
+        for (auto i = 0; i < std::min(m_parallel_games, total_games); i++) {
+            games.emplace_back([this, &basename]{ play_games(basename); });
+        }
+        for (auto& game : games) {
+            game.join();
+        }
+    }
+
+    myprintf("%d games: B+ %d, W+ %d, draws %d\n",
+             total_games, m_black_wins, m_white_wins, m_draws);
+    if (m_batch_stats.batches > 0) {
+        myprintf("shared evaluator: %d leaves in %d batches\n",
+                 m_batch_stats.leaves.load(), m_batch_stats.batches.load());
+    }
+}
+
+void SelfPlay::play_games(const std::string& basename) {
+    for (;;) {
+        const auto number = m_next_game++;
+        if (number >= m_total_games) {
+            return;
+        }
+        auto game = GameState{};
+        game.init_game(BOARD_SIZE);
+        const auto winner = play_game(game);
+        // The moves were recorded on this thread, see Training::m_data.
+        Training::dump_training(winner, basename + std::to_string(number));
+        Training::clear_training();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (winner == FastBoard::BLACK) {
+            m_black_wins++;
+        } else if (winner == FastBoard::WHITE) {
+            m_white_wins++;
+        } else {
+            m_draws++;
+        }
+        if (m_parallel_games > 1) {
+            myprintf("Game %d done, %d moves, %s\n", number,
+                     int(game.get_movenum()),
+                     winner == FastBoard::BLACK ? "B+"
+                     : winner == FastBoard::WHITE ? "W+" : "draw");
+        }
+    }
+}
+
+int SelfPlay::play_game(GameState& game) {
+    auto search = std::make_unique<UCTSearch>(game, m_network, m_evaluator);
+    search->set_tree_searches(m_parallel_games);
+    do {
+        // Playout cap randomization: only some moves get the full
+        // search and train the policy, the others are played fast.
+        // The tree is kept between them either way.
+        const auto fast = cfg_fast_visits > 0
+            && Random::get_Rng().randuint64(1000000)
+               >= cfg_full_search_prob * 1000000;
+        search->set_fast_search(fast);
+        const auto move = search->think(game.get_to_move(), UCTSearch::NORMAL);
+        game.play_move(move);
+        if (m_parallel_games == 1) {
+            game.display_state();
+        }
+    } while (!game.has_end() && !game.has_resigned());
+    search.reset();
+    // Other games still have their trees.
+    assert(m_parallel_games > 1 || UCTNodePointer::get_tree_size() == 0);
+
+    const auto score = game.final_score();
+    auto who_won = int{FastBoard::EMPTY};
+    if (score < -0.1) {
+        gtp_printf(-1, "W+%3.1f", float(std::fabs(score)));
+        who_won = FastBoard::WHITE;
+    } else if (score > 0.1) {
+        gtp_printf(-1, "B+%3.1f", score);
+        who_won = FastBoard::BLACK;
+    } else {
+        gtp_printf(-1, "0");
+    }
+    return who_won;
+}
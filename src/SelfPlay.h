@@ -27,49 +27,49 @@
     work.
 */
 
-#ifndef UTILS_H_INCLUDED
-#define UTILS_H_INCLUDED
+#ifndef SELFPLAY_H_INCLUDED
+#define SELFPLAY_H_INCLUDED
 
 #include "config.h"
 
 #include <atomic>
-#include <limits>
+#include <memory>
+#include <mutex>
 #include <string>
 
-#include "ThreadPool.h"
+#include "AsyncEvaluator.h"
+#include "GameState.h"
+#include "Network.h"
 
-extern Utils::ThreadPool thread_pool;
-
-namespace Utils {
-    void myprintf_error(const char *fmt, ...);
-    void myprintf(const char *fmt, ...);
-    void gtp_printf(int id, const char *fmt, ...);
-    void gtp_printf_raw(const char *fmt, ...);
-    void gtp_fail_printf(int id, const char *fmt, ...);
-    void log_input(const std::string& input);
-    bool input_pending();
-
-    template<class T>
-    void atomic_add(std::atomic<T> &f, T d) {
-        T old = f.load();
-        while (!f.compare_exchange_weak(old, old + d));
-    }
-
-    template<typename T>
-    T rotl(const T x, const int k) {
-        return (x << k) | (x >> (std::numeric_limits<T>::digits - k));
-    }
-
-    inline bool is7bit(int c) {
-        return c >= 0 && c <= 127;
-    }
-
-    size_t ceilMultiple(size_t a, size_t b);
-
-    const std::string leelaz_file(std::string file);
-
-    void create_z_table();
-    float cached_t_quantile(int v);
-}
+/*
+    Self-play games for training data, several at once in this process.
+    Every game runs its own search on its own thread. With --async the
+    searches share one evaluator, so their leaves fill the network
+    batches together. A finished game is written out right away.
+*/
+class SelfPlay {
+public:
+    SelfPlay(Network& network, int parallel_games);
+
+    // Plays total_games games, each to basename + its number.
+    void run(int total_games, const std::string& basename);
+
+private:
+    void play_games(const std::string& basename);
+    /// 下完一盘, 返回胜者
+    int play_game(GameState& game);
+
+    Network& m_network;
+    int m_parallel_games;
+    int m_total_games{0};
+    LeafBatchStats m_batch_stats;
+    std::shared_ptr<AsyncEvaluator> m_evaluator;
+    std::atomic<int> m_next_game{0};
+    // Guards the results below.
+    std::mutex m_mutex;
+    int m_black_wins{0};
+    int m_white_wins{0};
+    int m_draws{0};
+};
 
 #endif
@@ -0,0 +1,245 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include "config.h"
+#include "SequentialHalving.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <random>
+#include <utility>
+
+#include "GTP.h"
+#include "Random.h"
+
+constexpr float SequentialHalving::C_VISIT;
+constexpr float SequentialHalving::C_SCALE;
+
+void SequentialHalving::start(const UCTNode& root, int color, int budget) {
+    m_candidates.clear();
+    m_color = color;
+    m_budget = std::max(0, budget);
+
+    std::extreme_value_distribution<float> gumbel(0.0f, 1.0f);
+    const auto& children = root.get_children();
+    for (auto i = size_t{0}; i < children.size(); i++) {
+        const auto& child = children[i];
+        if (!child.valid()) {
+            continue;
+        }
+        auto candidate = Candidate{};
+        candidate.move = child.get_move();
+        candidate.index = i;
+        candidate.gumbel = gumbel(Random::get_Rng());
+        candidate.logit = std::log(std::max(child.get_policy(),
+                                            std::numeric_limits<float>::min()));
+        m_candidates.emplace_back(candidate);
+    }
+
+    // Gumbel-top-k: the m best of logit + gumbel are a sample of m moves
+    // without replacement from the policy. Known losses go last.
+    std::sort(begin(m_candidates), end(m_candidates),
+              [&](const Candidate& a, const Candidate& b) {
+                  const auto a_lost = is_lost(root, a);
+                  const auto b_lost = is_lost(root, b);
+                  if (a_lost != b_lost) {
+                      return b_lost;
+                  }
+                  return a.gumbel + a.logit > b.gumbel + b.logit;
+              });
+    const auto count = std::min(m_candidates.size(),
+                                size_t(std::max(1, cfg_gumbel_m)));
+    m_reserve.assign(rbegin(m_candidates),
+                     rend(m_candidates) - count);
+    m_candidates.resize(count);
+
+    m_phases = int(std::ceil(std::log2(std::max(size_t{2}, count))));
+    m_target = 0;
+    next_phase();
+    m_active = !m_candidates.empty();
+}
+
+void SequentialHalving::stop() {
+    m_active = false;
+}
+
+bool SequentialHalving::active() const {
+    return m_active;
+}
+
+void SequentialHalving::next_phase() {
+    const auto remaining = int(m_candidates.size());
+    m_target += std::max(1, m_budget / (m_phases * remaining));
+}
+
+bool SequentialHalving::is_lost(const UCTNode& root,
+                                const Candidate& candidate) const {
+    const auto& child = root.get_children()[candidate.index];
+    return child.is_proven() && child.get_proven_eval(m_color) < 0.5f;
+}
+
+bool SequentialHalving::phase_done(const UCTNode& root) const {
+    const auto& children = root.get_children();
+    for (const auto& candidate : m_candidates) {
+        if (children[candidate.index].get_visits() < m_target) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::size_t SequentialHalving::select(UCTNode& root,
+                                      ExpandWaitStats* wait_stats) {
+    auto shares = std::vector<std::pair<std::size_t, float>>{};
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // Visits to a lost move are wasted, try the next one instead.
+        for (auto& candidate : m_candidates) {
+            while (is_lost(root, candidate) && !m_reserve.empty()) {
+                candidate = m_reserve.back();
+                m_reserve.pop_back();
+            }
+        }
+        if (m_candidates.size() > 1 && phase_done(root)) {
+            const auto mixed_value = get_mixed_value(root);
+            std::stable_sort(begin(m_candidates), end(m_candidates),
+                [&](const Candidate& a, const Candidate& b) {
+                    return get_score(root, a, mixed_value)
+                           > get_score(root, b, mixed_value);
+                });
+            m_candidates.resize((m_candidates.size() + 1) / 2);
+            next_phase();
+        }
+        for (const auto& candidate : m_candidates) {
+            shares.emplace_back(candidate.index, 1.0f);
+        }
+    }
+    // Equal shares: the one with the fewest visits, counting the ones on
+    // their way.
+    return root.share_select_child(shares, wait_stats);
+}
+
+float SequentialHalving::get_sigma(const UCTNode& root, float q) const {
+    auto max_visits = 0;
+    for (const auto& child : root.get_children()) {
+        max_visits = std::max(max_visits, child.get_visits());
+    }
+    return (C_VISIT + max_visits) * C_SCALE * q;
+}
+
+float SequentialHalving::get_mixed_value(const UCTNode& root) const {
+    auto visits = 0;
+    auto visited_policy = 0.0f;
+    auto weighted_q = 0.0f;
+    for (const auto& child : root.get_children()) {
+        const auto child_visits = child.valid() ? child.get_visits() : 0;
+        if (child_visits > 0) {
+            visits += child_visits;
+            visited_policy += child.get_policy();
+            weighted_q += child.get_policy() * child->get_raw_eval(m_color);
+        }
+    }
+    const auto net_eval = root.get_net_eval(m_color);
+    if (visits == 0 || visited_policy <= 0.0f) {
+        return net_eval;
+    }
+    return (net_eval + visits * weighted_q / visited_policy) / (1 + visits);
+}
+
+float SequentialHalving::get_q(const UCTNodePointer& child,
+                                float mixed_value) const {
+    if (child.is_proven()) {
+        return child.get_proven_eval(m_color);
+    }
+    if (child.get_visits() > 0) {
+        return child->get_raw_eval(m_color);
+    }
+    return mixed_value;
+}
+
+float SequentialHalving::get_score(const UCTNode& root,
+                                   const Candidate& candidate,
+                                   float mixed_value) const {
+    const auto& child = root.get_children()[candidate.index];
+    return candidate.gumbel + candidate.logit
+           + get_sigma(root, get_q(child, mixed_value));
+}
+
+int SequentialHalving::get_best_move(const UCTNode& root) const {
+    assert(!m_candidates.empty());
+    // The children may have been sorted since the search, find them again.
+    const auto& children = root.get_children();
+    auto candidates = m_candidates;
+    for (auto& candidate : candidates) {
+        for (auto i = size_t{0}; i < children.size(); i++) {
+            if (children[i].get_move() == candidate.move) {
+                candidate.index = i;
+            }
+        }
+    }
+    const auto mixed_value = get_mixed_value(root);
+    const auto best = std::max_element(begin(candidates), end(candidates),
+        [&](const Candidate& a, const Candidate& b) {
+            return get_score(root, a, mixed_value)
+                   < get_score(root, b, mixed_value);
+        });
+    return best->move;
+}
+
+std::vector<float> SequentialHalving::get_improved_policy(
+        const UCTNode& root) const {
+    const auto& children = root.get_children();
+    const auto mixed_value = get_mixed_value(root);
+    auto policy = std::vector<float>(children.size(), 0.0f);
+    auto max_logit = std::numeric_limits<float>::lowest();
+    for (auto i = size_t{0}; i < children.size(); i++) {
+        const auto& child = children[i];
+        if (!child.valid()) {
+            continue;
+        }
+        policy[i] = std::log(std::max(child.get_policy(),
+                                      std::numeric_limits<float>::min()))
+                    + get_sigma(root, get_q(child, mixed_value));
+        max_logit = std::max(max_logit, policy[i]);
+    }
+    auto sum = 0.0f;
+    for (auto i = size_t{0}; i < children.size(); i++) {
+        if (children[i].valid()) {
+            policy[i] = std::exp(policy[i] - max_logit);
+            sum += policy[i];
+        }
+    }
+    for (auto& p : policy) {
+        p /= sum;
+    }
+    return policy;
+}
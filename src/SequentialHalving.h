@@ -0,0 +1,108 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#ifndef SEQUENTIALHALVING_H_INCLUDED
+#define SEQUENTIALHALVING_H_INCLUDED
+
+#include "config.h"
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include "UCTNode.h"
+
+/*
+    Root move selection of Gumbel AlphaZero (Danihelka et al., "Policy
+    improvement by planning with Gumbel", ICLR 2022).
+
+    Up to cfg_gumbel_m root moves are sampled without replacement by
+    adding Gumbel noise to their policy logits. The visit budget is split
+    into ceil(log2(m)) phases. In each phase the remaining moves get the
+    same number of visits, then the worse half by
+    gumbel + logit + sigma(q) is dropped. The last one left is played,
+    and the training target is softmax(logit + sigma(completed q)).
+*/
+class SequentialHalving {
+public:
+    // Weight of the values against the logits.
+    static constexpr float C_VISIT = 50.0f;
+    static constexpr float C_SCALE = 1.0f;
+
+    // Samples the moves out of root's children, which must all be
+    // inflated, for a search of budget more visits.
+    void start(const UCTNode& root, int color, int budget);
+    void stop();
+    bool active() const;
+
+    // The child for the next simulation, with a virtual loss like
+    // UCTNode::uct_select_child().
+    std::size_t select(UCTNode& root, ExpandWaitStats* wait_stats);
+    // Best of the moves still in, once the search is over.
+    int get_best_move(const UCTNode& root) const;
+    // Improved policy for every child of root, in their current order.
+    std::vector<float> get_improved_policy(const UCTNode& root) const;
+
+private:
+    struct Candidate {
+        int move;
+        // Index at the root while the search runs.
+        std::size_t index;
+        float gumbel;
+        float logit;
+    };
+
+    float get_sigma(const UCTNode& root, float q) const;
+    // Value of the unvisited children: the net eval of the root mixed
+    // with the policy weighted values of the visited ones.
+    float get_mixed_value(const UCTNode& root) const;
+    // Value of a child: its proof, the result of its visits, or
+    // mixed_value.
+    float get_q(const UCTNodePointer& child, float mixed_value) const;
+    float get_score(const UCTNode& root, const Candidate& candidate,
+                    float mixed_value) const;
+    bool is_lost(const UCTNode& root, const Candidate& candidate) const;
+    bool phase_done(const UCTNode& root) const;
+    void next_phase();
+
+    std::mutex m_mutex;
+    // Moves still in, best first after each halving.
+    std::vector<Candidate> m_candidates;
+    // The rest of the sample, next first. They stand in for moves that
+    // turn out to be proven losses.
+    std::vector<Candidate> m_reserve;
+    int m_color;
+    int m_budget;
+    int m_phases;
+    // Visits every move still in has at the end of the phase.
+    int m_target;
+    bool m_active{false};
+};
+
+#endif
@@ -0,0 +1,170 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include "config.h"
+#include "StripedStats.h"
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "UCTNodePointer.h"
+#include "Utils.h"
+
+namespace {
+    // Root and root children of every tree alive, with room to spare for
+    // the trees still being deleted.
+    constexpr auto MAX_STATS = std::uint32_t{1} << 15;
+
+    std::array<std::atomic<StripedStats*>, MAX_STATS> s_table{};
+    std::mutex s_mutex;
+    std::vector<std::uint32_t> s_free;
+    std::uint32_t s_used{1};
+
+    std::atomic<int> s_next_stripe{0};
+}
+
+int Striped::get_stripe() {
+    thread_local auto stripe = s_next_stripe++ % STRIPES;
+    return stripe;
+}
+
+int Striped::get_used_stripes() {
+    return std::min(s_next_stripe.load(std::memory_order_relaxed), STRIPES);
+}
+
+void StripedCounter::add(int count) {
+    m_stripes[Striped::get_stripe()].count.fetch_add(
+        count, std::memory_order_relaxed);
+}
+
+int StripedCounter::load() const {
+    auto count = 0;
+    const auto used = Striped::get_used_stripes();
+    for (auto i = 0; i < used; i++) {
+        count += m_stripes[i].count.load(std::memory_order_relaxed);
+    }
+    return count;
+}
+
+void StripedCounter::clear() {
+    for (auto& stripe : m_stripes) {
+        stripe.count = 0;
+    }
+}
+
+std::uint32_t StripedStats::allocate() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    auto index = std::uint32_t{0};
+    if (!s_free.empty()) {
+        index = s_free.back();
+        s_free.pop_back();
+    } else if (s_used < MAX_STATS) {
+        index = s_used++;
+    } else {
+        return 0;
+    }
+    s_table[index] = new StripedStats();
+    UCTNodePointer::increment_tree_size(sizeof(StripedStats));
+    return index;
+}
+
+void StripedStats::release(std::uint32_t index) {
+    assert(index > 0 && index < MAX_STATS);
+    std::lock_guard<std::mutex> lock(s_mutex);
+    delete s_table[index].exchange(nullptr);
+    UCTNodePointer::decrement_tree_size(sizeof(StripedStats));
+    s_free.emplace_back(index);
+}
+
+StripedStats& StripedStats::get(std::uint32_t index) {
+    assert(index > 0 && index < MAX_STATS);
+    return *s_table[index].load(std::memory_order_relaxed);
+}
+
+void StripedStats::add(float eval) {
+    auto& stripe = m_stripes[Striped::get_stripe()];
+    // Welford's online algorithm, as in UCTNode::update().
+    const auto old_visits = stripe.visits.load(std::memory_order_relaxed);
+    const auto old_eval = stripe.blackevals.load(std::memory_order_relaxed);
+    const auto old_delta = old_visits > 0 ? eval - old_eval / old_visits : 0.0;
+    const auto new_delta = eval - (old_eval + eval) / (old_visits + 1);
+    stripe.visits.fetch_add(1, std::memory_order_relaxed);
+    Utils::atomic_add(stripe.blackevals, double(eval));
+    Utils::atomic_add(stripe.squared_eval_diff, float(old_delta * new_delta));
+}
+
+int StripedStats::get_visits() const {
+    auto visits = 0;
+    const auto used = Striped::get_used_stripes();
+    for (auto i = 0; i < used; i++) {
+        visits += m_stripes[i].visits.load(std::memory_order_relaxed);
+    }
+    return visits;
+}
+
+double StripedStats::get_blackevals() const {
+    auto blackevals = 0.0;
+    const auto used = Striped::get_used_stripes();
+    for (auto i = 0; i < used; i++) {
+        blackevals += m_stripes[i].blackevals.load(std::memory_order_relaxed);
+    }
+    return blackevals;
+}
+
+// Every group of visits adds its own squared differences plus those of
+// its mean from the overall mean: sum(M2 + sum^2 / n) - total^2 / N.
+double StripedStats::get_squared_eval_diff(int visits, double blackevals,
+                                           double squared_eval_diff) const {
+    auto total_visits = visits;
+    auto total_blackevals = blackevals;
+    auto sum = squared_eval_diff;
+    if (visits > 0) {
+        sum += blackevals * blackevals / visits;
+    }
+    const auto used = Striped::get_used_stripes();
+    for (auto i = 0; i < used; i++) {
+        const auto& stripe = m_stripes[i];
+        const auto n = stripe.visits.load(std::memory_order_relaxed);
+        if (n == 0) {
+            continue;
+        }
+        const auto evals = stripe.blackevals.load(std::memory_order_relaxed);
+        total_visits += n;
+        total_blackevals += evals;
+        sum += stripe.squared_eval_diff.load(std::memory_order_relaxed)
+               + evals * evals / n;
+    }
+    if (total_visits > 0) {
+        sum -= total_blackevals * total_blackevals / total_visits;
+    }
+    return std::max(sum, 0.0);
+}
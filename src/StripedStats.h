@@ -0,0 +1,105 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#ifndef STRIPEDSTATS_H_INCLUDED
+#define STRIPEDSTATS_H_INCLUDED
+
+#include "config.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/*
+    Sums that every search thread adds to, split into one stripe per thread
+    so the adds don't bounce a cache line between cores. Readers add the
+    stripes up. Threads get their stripe round robin, with more threads
+    than stripes some of them share.
+    Stripes are 128 bytes apart, so no two of them share a cache line or
+    an adjacent-line prefetch pair however the block is aligned.
+*/
+namespace Striped {
+    static constexpr auto STRIPES = 32;
+    static constexpr auto STRIPE_BYTES = 128;
+
+    // Stripe of the calling thread.
+    int get_stripe();
+    // Stripes handed out so far, readers don't look further.
+    int get_used_stripes();
+}
+
+class StripedCounter {
+public:
+    void add(int count);
+    int load() const;
+    void clear();
+
+private:
+    struct Stripe {
+        std::atomic<int> count{0};
+        char padding[Striped::STRIPE_BYTES - sizeof(std::atomic<int>)];
+    };
+    std::array<Stripe, Striped::STRIPES> m_stripes;
+};
+
+/*
+    Visits and evals of one UCTNode that gets updated by every thread, the
+    root and its children. UCTNode is too size-sensitive for a pointer, it
+    keeps an index into a table instead, 0 for none.
+*/
+class StripedStats {
+public:
+    // Returns 0 if the table is full, the node then does without.
+    static std::uint32_t allocate();
+    static void release(std::uint32_t index);
+    static StripedStats& get(std::uint32_t index);
+
+    // One visit. Every stripe keeps its own running variance, so this
+    // doesn't look at the other stripes.
+    void add(float eval);
+    int get_visits() const;
+    double get_blackevals() const;
+    // Sum of squared differences from the mean over all stripes and the
+    // visits kept outside of them.
+    double get_squared_eval_diff(int visits, double blackevals,
+                                 double squared_eval_diff) const;
+
+private:
+    struct Stripe {
+        std::atomic<double> blackevals{0.0};
+        std::atomic<int> visits{0};
+        std::atomic<float> squared_eval_diff{0.0f};
+        char padding[Striped::STRIPE_BYTES - 16];
+    };
+    static_assert(sizeof(Stripe) == Striped::STRIPE_BYTES, "stripe padding");
+    std::array<Stripe, Striped::STRIPES> m_stripes;
+};
+
+#endif
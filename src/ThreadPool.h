@@ -128,6 +128,7 @@ public:
         for (auto && result : m_taskresults) {
             result.get();
         }
+        m_taskresults.clear();
     }
 private:
     ThreadPool & m_pool;
@@ -0,0 +1,256 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include "config.h"
+#include "ThreatSearch.h"
+
+#include <array>
+#include <bitset>
+#include <cassert>
+#include <utility>
+
+void ThreatStats::clear() {
+    tries = 0;
+    wins = 0;
+    losses = 0;
+    hits = 0;
+    nodes = 0;
+}
+
+int ThreatStats::saved_evals() const {
+    return wins + losses + hits;
+}
+
+ThreatSearch::ThreatSearch(const FastState& state, int max_nodes, int max_threes)
+    : m_board(state.board), m_to_move(state.get_to_move()),
+      m_max_nodes(max_nodes), m_max_threes(max_threes) {
+}
+
+ThreatSearch::result_t ThreatSearch::solve() {
+    if (attack(m_to_move, m_max_threes, nullptr)) {
+        return WIN;
+    }
+    /// 对方已经有威胁, 怎么防都挡不住. 这里对方的威胁是已经摆在盘面上的,
+    /// 所以多给一步活三
+    if (defend(!m_to_move, m_max_threes + 1, nullptr)) {
+        return LOSS;
+    }
+    return UNKNOWN;
+}
+
+int ThreatSearch::get_best_move() const {
+    return m_best_move;
+}
+
+int ThreatSearch::get_nodes() const {
+    return m_nodes;
+}
+
+/// color走, 能不能靠连续的四和活三赢. proof不为空时记下VCF用到的点
+bool ThreatSearch::attack(int color, int threes, std::vector<int>* proof) {
+    if (!charge()) {
+        return false;
+    }
+    auto fives = m_board.get_five_points(color);
+    if (!fives.empty()) {
+        if (proof) {
+            proof->emplace_back(fives[0]);
+        }
+        if (m_ply == 0) {
+            m_best_move = fives[0];
+        }
+        return true;
+    }
+
+    std::vector<int> moves;
+    auto blocks = m_board.get_five_points(!color);
+    if (blocks.size() > 1) {
+        return false;
+    } else if (blocks.size() == 1) {
+        /// 对方有四, 只能先挡
+        if (!is_legal(color, blocks[0])) {
+            return false;
+        }
+        moves = std::move(blocks);
+    } else {
+        moves = find_threats(color, threes > 0);
+    }
+
+    for (auto move : moves) {
+        play(move, color);
+        auto win = defend(color, threes, proof);
+        undo(move);
+        if (win) {
+            if (proof) {
+                proof->emplace_back(move);
+            }
+            if (m_ply == 0) {
+                m_best_move = move;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+/// attacker刚走完, 轮到对方. 返回attacker是不是还赢
+bool ThreatSearch::defend(int attacker, int threes, std::vector<int>* proof) {
+    const auto defender = !attacker;
+    if (!m_board.get_five_points(defender).empty()) {
+        return false;
+    }
+    auto fives = m_board.get_five_points(attacker);
+    if (fives.size() > 1
+        || (fives.size() == 1 && !is_legal(defender, fives[0]))) {
+        if (proof) {
+            proof->insert(end(*proof), begin(fives), end(fives));
+        }
+        return true;
+    } else if (fives.size() == 1) {
+        auto block = fives[0];
+        play(block, defender);
+        auto win = attack(attacker, threes, proof);
+        undo(block);
+        if (win && proof) {
+            proof->emplace_back(block);
+        }
+        return win;
+    }
+
+    /// 不是四, 那就得是对方不管的话能VCF的威胁
+    if (threes == 0) {
+        return false;
+    }
+    std::vector<int> vcf;
+    if (!attack(attacker, 0, &vcf)) {
+        return false;
+    }
+    for (auto move : find_defenses(defender, vcf)) {
+        play(move, defender);
+        auto win = attack(attacker, threes - 1, nullptr);
+        undo(move);
+        if (!win) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ThreatSearch::charge() {
+    return ++m_nodes <= m_max_nodes;
+}
+
+void ThreatSearch::play(int vertex, int color) {
+    m_board.set_state(vertex, FastBoard::vertex_t(color));
+    m_ply++;
+}
+
+void ThreatSearch::undo(int vertex) {
+    m_board.set_state(vertex, FastBoard::EMPTY);
+    m_ply--;
+}
+
+bool ThreatSearch::is_legal(int color, int vertex) const {
+    return m_board.get_state(vertex) == FastBoard::EMPTY
+           && (color == FastBoard::WHITE
+               || !m_board.is_forbidden(vertex, FastBoard::BLACK));
+}
+
+/// 线上(x, y)两侧NUM_IN_A_ROW - 1格以内color的子数. 成四至少要3个, 活三2个,
+/// 不够的就不用去查棋型表
+int ThreatSearch::stones_near(int color, int direction, int x, int y) const {
+    constexpr auto reach = NUM_IN_A_ROW - 1;
+    constexpr auto window = (std::uint64_t{1} << (2 * reach + 1)) - 1;
+    auto line = std::uint64_t{m_board.get_line(color, direction, x, y)};
+    auto pos = FastBoard::get_line_pos(direction, x, y);
+    return int(std::bitset<2 * reach + 1>(((line << reach) >> pos) & window).count());
+}
+
+/// 能成四的点排在前面, threes时再加上能成活三的点
+std::vector<int> ThreatSearch::find_threats(int color, bool threes) const {
+    std::vector<int> fours, live_threes;
+    for (int y = 0; y < BOARD_SIZE; y++) {
+        for (int x = 0; x < BOARD_SIZE; x++) {
+            auto vertex = m_board.get_vertex(x, y);
+            if (m_board.get_state(vertex) != FastBoard::EMPTY) {
+                continue;
+            }
+            auto four = false, three = false;
+            for (int direction = 0; direction < 4; direction++) {
+                if (stones_near(color, direction, x, y) < NUM_IN_A_ROW - 3) {
+                    continue;
+                }
+                auto pattern = m_board.get_pattern(color, direction, x, y);
+                four |= pattern.fours > 0;
+                three |= pattern.type == FastBoard::LIVE_TREE;
+            }
+            if ((four || (threes && three)) && is_legal(color, vertex)) {
+                (four ? fours : live_threes).emplace_back(vertex);
+            }
+        }
+    }
+    fours.insert(end(fours), begin(live_threes), end(live_threes));
+    return fours;
+}
+
+/*
+    Moves that could stop a VCF. A stone changes the pattern of a point only
+    when it is on one of its lines within PATTERN_REACH, so anything not near
+    a point of the VCF leaves it intact, except a four of our own.
+*/
+std::vector<int> ThreatSearch::find_defenses(int color,
+                                             const std::vector<int>& proof) const {
+    static constexpr std::array<std::pair<int, int>, 4> dirs{{
+        {0, -1}, {1, 0}, {1, -1}, {1, 1}
+    }};
+    std::array<bool, FastBoard::NUM_VERTICES> zone{};
+    for (auto vertex : proof) {
+        auto xy = m_board.get_xy(vertex);
+        for (const auto& dir : dirs) {
+            for (int dist = -FastBoard::PATTERN_REACH; dist <= FastBoard::PATTERN_REACH; dist++) {
+                auto x = xy.first + dist * dir.first;
+                auto y = xy.second + dist * dir.second;
+                if (x >= 0 && x < BOARD_SIZE && y >= 0 && y < BOARD_SIZE) {
+                    zone[m_board.get_vertex(x, y)] = true;
+                }
+            }
+        }
+    }
+    for (auto vertex : find_threats(color, false)) {
+        zone[vertex] = true;
+    }
+
+    std::vector<int> moves;
+    for (auto vertex = 0; vertex < FastBoard::NUM_VERTICES; vertex++) {
+        if (zone[vertex] && is_legal(color, vertex)) {
+            moves.emplace_back(vertex);
+        }
+    }
+    return moves;
+}
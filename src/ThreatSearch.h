@@ -0,0 +1,99 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#ifndef THREATSEARCH_H_INCLUDED
+#define THREATSEARCH_H_INCLUDED
+
+#include "config.h"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "FastBoard.h"
+#include "FastState.h"
+
+/*
+    Counters for one search, shared by all search threads.
+*/
+struct ThreatStats {
+    std::atomic<int> tries{0};
+    std::atomic<int> wins{0};
+    std::atomic<int> losses{0};
+    // visits to proven nodes, each of them would have needed a new node
+    std::atomic<int> hits{0};
+    std::atomic<std::int64_t> nodes{0};
+
+    void clear();
+    int saved_evals() const;
+};
+
+/*
+    Threat space search: tries to prove a win for the side to move with
+    continuous fours (VCF) and live threes (VCT), or a loss when the
+    opponent already has such a win that can't be stopped. Everything
+    proven is exact, running out of budget only loses proofs.
+*/
+class ThreatSearch {
+public:
+    enum result_t : char {
+        UNKNOWN = 0, WIN = 1, LOSS = 2
+    };
+
+    /// max_nodes是搜索的节点数上限, max_threes是一条线上最多几步活三威胁, 0就只算VCF
+    ThreatSearch(const FastState& state, int max_nodes, int max_threes);
+
+    /// 站在轮走方看的结果
+    result_t solve();
+    /// 证明了WIN时的第一步
+    int get_best_move() const;
+    int get_nodes() const;
+
+private:
+    bool attack(int color, int threes, std::vector<int>* proof);
+    bool defend(int attacker, int threes, std::vector<int>* proof);
+
+    bool charge();
+    void play(int vertex, int color);
+    void undo(int vertex);
+    bool is_legal(int color, int vertex) const;
+    int stones_near(int color, int direction, int x, int y) const;
+    std::vector<int> find_threats(int color, bool threes) const;
+    std::vector<int> find_defenses(int color, const std::vector<int>& proof) const;
+
+    FastBoard m_board;
+    int m_to_move;
+    int m_max_nodes;
+    int m_max_threes;
+    int m_nodes{0};
+    int m_ply{0};
+    int m_best_move{FastBoard::PASS};
+};
+
+#endif
@@ -53,7 +53,7 @@
 #include "string.h"
 #include "zlib.h"
 
-std::vector<TimeStep> Training::m_data{};
+thread_local std::vector<TimeStep> Training::m_data{};
 
 std::ostream& operator <<(std::ostream& stream, const TimeStep& timestep) {
     stream << timestep.planes.size() << ' ';
@@ -68,7 +68,8 @@ std::ostream& operator <<(std::ostream& stream, const TimeStep& timestep) {
     stream << timestep.net_winrate << ' ';
     stream << timestep.root_uct_winrate << ' ';
     stream << timestep.child_uct_winrate << ' ';
-    stream << timestep.bestmove_visits << std::endl;
+    stream << timestep.bestmove_visits << ' ';
+    stream << timestep.full_search << std::endl;
     return stream;
 }
 
@@ -92,6 +93,7 @@ std::istream& operator>> (std::istream& stream, TimeStep& timestep) {
     stream >> timestep.root_uct_winrate;
     stream >> timestep.child_uct_winrate;
     stream >> timestep.bestmove_visits;
+    stream >> timestep.full_search;
     return stream;
 }
 
@@ -168,9 +170,12 @@ TimeStep::NNPlanes Training::get_planes(const GameState* const state) {
     return planes;
 }
 
-void Training::record(Network & network, GameState& state, UCTNode& root) {
+void Training::record(Network & network, GameState& state, UCTNode& root,
+                      const std::vector<float>& policy,
+                      bool full_search) {
     auto step = TimeStep{};
     step.to_move = state.board.get_to_move();
+    step.full_search = full_search;
     step.planes = get_planes(&state);
 
     const auto result = network.get_output(
@@ -179,7 +184,15 @@ void Training::record(Network & network, GameState& state, UCTNode& root) {
 
     const auto& best_node = root.get_best_root_child(step.to_move);
     step.root_uct_winrate = root.get_eval(step.to_move);
-    step.child_uct_winrate = best_node.get_eval(step.to_move);
+    // A proven win comes first even if it was never visited, and a root
+    // proven by the threat search right away has no visited children.
+    if (!best_node.first_visit()) {
+        step.child_uct_winrate = best_node.get_eval(step.to_move);
+    } else if (best_node.is_proven()) {
+        step.child_uct_winrate = best_node.get_proven_eval(step.to_move);
+    } else {
+        step.child_uct_winrate = step.root_uct_winrate;
+    }
     step.bestmove_visits = best_node.get_visits();
 
     step.probabilities.resize(POTENTIAL_MOVES);
@@ -199,8 +212,13 @@ void Training::record(Network & network, GameState& state, UCTNode& root) {
         return;
     }
 
-    for (const auto& child : root.get_children()) {
-        auto prob = static_cast<float>(child->get_visits() / sum_visits);
+    const auto& children = root.get_children();
+    assert(policy.empty() || policy.size() == children.size());
+    for (auto i = size_t{0}; i < children.size(); i++) {
+        const auto& child = children[i];
+        auto prob = policy.empty()
+                    ? static_cast<float>(child->get_visits() / sum_visits)
+                    : policy[i];
         auto move = child->get_move();
         if (move != FastBoard::PASS) {
             auto xy = state.board.get_xy(move);
@@ -288,6 +306,9 @@ void Training::dump_training(int winner_color, OutputChunker& outchunk) {
             out << "-1";
         }
         out << std::endl;
+        // Last whether the probabilities are a policy target, 0 for the
+        // moves of a fast search.
+        out << (step.full_search ? "1" : "0") << std::endl;
         training_str.append(out.str());
     }
     outchunk.append(training_str);
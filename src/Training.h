@@ -53,6 +53,8 @@ public:
     float root_uct_winrate;
     float child_uct_winrate;
     int bestmove_visits;
+    // Fast searches only play the move, their policy is no training target.
+    bool full_search{true};
 };
 
 std::ostream& operator<< (std::ostream& stream, const TimeStep& timestep);
@@ -82,7 +84,11 @@ public:
     static void dump_training(int winner_color,
                               const std::string& out_filename);
     static void dump_debug(const std::string& out_filename);
-    static void record(Network & network, GameState& state, UCTNode& node);
+    // The target is the visit distribution of the root's children, or
+    // policy in the order of the children if it is given.
+    static void record(Network & network, GameState& state, UCTNode& node,
+                       const std::vector<float>& policy = {},
+                       bool full_search = true);
 
     static void dump_supervised(const std::string& sgf_file,
                                 const std::string& out_filename);
@@ -99,7 +105,8 @@ private:
     static void dump_debug(OutputChunker& outchunker);
     static void save_training(std::ofstream& out);
     static void load_training(std::ifstream& in);
-    static std::vector<TimeStep> m_data;
+    // Per thread, every game of --selfplay records its own moves.
+    static thread_local std::vector<TimeStep> m_data;
 };
 
 #endif
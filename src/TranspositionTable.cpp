@@ -0,0 +1,100 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include "config.h"
+#include "TranspositionTable.h"
+
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "FastBoard.h"
+#include "UCTNode.h"
+
+UCTNode* TranspositionTable::get_node(std::uint64_t hash) {
+    auto& shard = get_shard(hash);
+    LOCK(shard.mutex, lock);
+    auto it = shard.nodes.find(hash);
+    if (it == end(shard.nodes)) {
+        it = shard.nodes.emplace(hash,
+            UCTNodePointer(FastBoard::PASS, 0.0f)).first;
+        it->second.inflate();
+        m_size++;
+    }
+    return it->second.get();
+}
+
+std::unique_ptr<UCTNode> TranspositionTable::release_node(std::uint64_t hash) {
+    auto& shard = get_shard(hash);
+    LOCK(shard.mutex, lock);
+    auto it = shard.nodes.find(hash);
+    if (it == end(shard.nodes)) {
+        return nullptr;
+    }
+    auto node = std::unique_ptr<UCTNode>(it->second.release());
+    shard.nodes.erase(it);
+    m_size--;
+    return node;
+}
+
+size_t TranspositionTable::retain_reachable(const UCTNode& root) {
+    // Only called between searches, so nothing changes underneath us.
+    auto reachable = std::unordered_set<const UCTNode*>{};
+    auto todo = std::vector<const UCTNode*>{&root};
+    while (!todo.empty()) {
+        const auto node = todo.back();
+        todo.pop_back();
+        // The children of the root are its own, all others are ours.
+        for (const auto& child : node->get_children()) {
+            if ((child.is_inflated() || child.is_linked())
+                && reachable.insert(child.get()).second) {
+                todo.emplace_back(child.get());
+            }
+        }
+    }
+
+    auto nodes = size_t{0};
+    m_size = 0;
+    for (auto& shard : m_shards) {
+        for (auto it = begin(shard.nodes); it != end(shard.nodes);) {
+            if (reachable.count(it->second.get())) {
+                nodes += it->second->count_nodes_and_clear_expand_state();
+                m_size++;
+                ++it;
+            } else {
+                it = shard.nodes.erase(it);
+            }
+        }
+    }
+    return nodes;
+}
+
+size_t TranspositionTable::size() const {
+    return m_size;
+}
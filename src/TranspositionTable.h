@@ -0,0 +1,81 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#ifndef TRANSPOSITIONTABLE_H_INCLUDED
+#define TRANSPOSITIONTABLE_H_INCLUDED
+
+#include "config.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+#include "SMP.h"
+#include "UCTNodePointer.h"
+
+class UCTNode;
+
+/*
+    Turns the search tree into a graph. Gomoku has no captures, so the
+    same position comes up through many move orders. Every position gets
+    one node here, keyed by its hash, and the children of all the move
+    orders link to it (see UCTNodePointer::link()). A parent counts the
+    visits through its own link, the value is that of the shared node.
+    Only the children of the root are owned by the root instead.
+*/
+class TranspositionTable {
+public:
+    /// 这个局面共享的节点, 第一次遇到就新建一个
+    UCTNode* get_node(std::uint64_t hash);
+    /// 把局面的节点从表里拿出来, 给新的根节点用
+    std::unique_ptr<UCTNode> release_node(std::uint64_t hash);
+    /// 只留下从root还能走到的局面, 返回留下的节点数
+    size_t retain_reachable(const UCTNode& root);
+    size_t size() const;
+
+private:
+    static constexpr auto NUM_SHARDS = 64;
+
+    struct Shard {
+        SMP::Mutex mutex;
+        std::unordered_map<std::uint64_t, UCTNodePointer> nodes;
+    };
+
+    Shard& get_shard(std::uint64_t hash) {
+        return m_shards[hash % NUM_SHARDS];
+    }
+
+    std::array<Shard, NUM_SHARDS> m_shards;
+    std::atomic<size_t> m_size{0};
+};
+
+#endif
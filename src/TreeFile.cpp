@@ -0,0 +1,269 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include "config.h"
+#include "TreeFile.h"
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <utility>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "StripedStats.h"
+#include "Utils.h"
+
+using namespace Utils;
+
+static constexpr char TREE_MAGIC[8] = {'L', 'Z', 'G', 'T', 'R', 'E', 'E', '1'};
+
+TreeFile::Record TreeFile::to_record(const UCTNodePointer& child) {
+    if (child.is_inflated()) {
+        return to_record(*child);
+    }
+    // What a fresh UCTNode starts with.
+    auto record = Record{};
+    record.move = std::int16_t(child.get_move());
+    record.policy = child.get_policy();
+    record.squared_eval_diff = 1e-4f;
+    record.min_psa_ratio = 2.0f;
+    record.status = UCTNode::ACTIVE;
+    return record;
+}
+
+TreeFile::Record TreeFile::to_record(const UCTNode& node) {
+    auto record = Record{};
+    record.move = node.m_move;
+    record.policy = node.m_policy;
+    record.visits = node.get_visits();
+    record.blackevals = node.get_blackevals();
+    record.net_eval = node.m_net_eval;
+    record.squared_eval_diff = node.m_squared_eval_diff;
+    if (node.m_striped) {
+        record.squared_eval_diff = float(
+            StripedStats::get(node.m_striped).get_squared_eval_diff(
+                node.m_visits, node.m_blackevals, node.m_squared_eval_diff));
+    }
+    record.min_psa_ratio = node.m_min_psa_ratio_children;
+    record.status = node.m_status;
+    record.proven = std::uint8_t(node.m_proven.load());
+    return record;
+}
+
+bool TreeFile::save(const std::string& tree_file,
+                    const UCTNode& root, const GameState& state) {
+    static_assert(sizeof(Record) == 40,
+                  "tree records are read straight from the file");
+
+    // Breadth first: a node's children are appended together when the
+    // node itself comes up.
+    auto records = std::vector<Record>{to_record(root)};
+    auto nodes = std::vector<const UCTNode*>{&root};
+    for (auto i = size_t{0}; i < nodes.size(); i++) {
+        if (!nodes[i]) {
+            continue;
+        }
+        const auto& children = nodes[i]->get_children();
+        records[i].first_child = std::uint32_t(records.size());
+        records[i].children = std::uint32_t(children.size());
+        for (const auto& child : children) {
+            records.emplace_back(to_record(child));
+            // Keep nodes in step with records.
+            nodes.emplace_back(child.is_inflated() ? child.get() : nullptr);
+        }
+    }
+
+    std::ofstream out(tree_file, std::ios::binary);
+    if (!out) {
+        myprintf("Could not open %s for writing.\n", tree_file.c_str());
+        return false;
+    }
+    auto header = Header{};
+    std::memcpy(header.magic, TREE_MAGIC, sizeof(header.magic));
+    header.board_size = BOARD_SIZE;
+    header.movenum = std::uint32_t(state.get_movenum());
+    header.hash = state.board.get_hash();
+    header.count = std::uint32_t(records.size());
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(records.data()),
+              records.size() * sizeof(Record));
+    out.close();
+    if (!out) {
+        myprintf("Error writing %s.\n", tree_file.c_str());
+        return false;
+    }
+
+    myprintf("Tree: %zu nodes, %d visits written to %s.\n",
+             records.size(), root.get_visits(), tree_file.c_str());
+    return true;
+}
+
+// A pass or a point on the board.
+static bool valid_move(int move) {
+    if (move == FastBoard::PASS) {
+        return true;
+    }
+    const auto x = move % (BOARD_SIZE + 2) - 1;
+    const auto y = move / (BOARD_SIZE + 2) - 1;
+    return move > 0 && x >= 0 && x < BOARD_SIZE && y >= 0 && y < BOARD_SIZE;
+}
+
+bool TreeFile::read_node(const Record& record, UCTNode& node) {
+    if (!valid_move(record.move)
+        || record.visits < 0 || record.status > UCTNode::ACTIVE
+        || record.proven > std::uint8_t(UCTNode::Proven::WIN)
+        || !std::isfinite(record.policy) || !std::isfinite(record.blackevals)
+        || !std::isfinite(record.net_eval)
+        || !std::isfinite(record.squared_eval_diff)
+        || !std::isfinite(record.min_psa_ratio)) {
+        return false;
+    }
+    node.m_visits = record.visits;
+    node.m_blackevals = record.blackevals;
+    node.m_net_eval = record.net_eval;
+    node.m_squared_eval_diff = record.squared_eval_diff;
+    node.m_min_psa_ratio_children = record.min_psa_ratio;
+    node.m_status = UCTNode::Status(record.status);
+    node.m_proven = UCTNode::Proven(record.proven);
+    return true;
+}
+
+bool TreeFile::read_tree(const Record* records, std::uint32_t count,
+                         UCTNode& root) {
+    // Going through the records in order, every run of children has to
+    // start right after the last one, as save() wrote them. Then every
+    // record is read exactly once and the tree can't loop.
+    auto next = std::uint32_t{1};
+    auto nodes = std::vector<UCTNode*>(count, nullptr);
+    nodes[0] = &root;
+    auto parents = std::vector<UCTNode*>{};
+    for (auto index = std::uint32_t{0}; index < next; index++) {
+        const auto& record = records[index];
+        const auto node = nodes[index];
+        if (!node) {
+            // A child that was never visited, it has no run of its own.
+            continue;
+        }
+        if (!read_node(record, *node)) {
+            return false;
+        }
+        if (record.children == 0) {
+            continue;
+        }
+        if (record.first_child != next
+            || record.children > count - next) {
+            return false;
+        }
+        next += record.children;
+
+        node->m_children.reserve(record.children);
+        for (auto i = record.first_child; i < next; i++) {
+            const auto& child = records[i];
+            if (!valid_move(child.move) || !std::isfinite(child.policy)) {
+                return false;
+            }
+            node->m_children.emplace_back(child.move, child.policy);
+            if (child.visits == 0 && child.children == 0
+                && child.status == UCTNode::ACTIVE && child.proven == 0) {
+                continue;
+            }
+            node->m_children.back().inflate();
+            nodes[i] = node->m_children.back().get();
+        }
+        parents.emplace_back(node);
+    }
+    if (next != count) {
+        return false;
+    }
+    // The children have their stats now.
+    for (const auto node : parents) {
+        node->m_child_stats.resize(node->m_children.size());
+        node->refresh_child_stats();
+        node->m_expand_state = UCTNode::ExpandState::EXPANDED;
+    }
+    return true;
+}
+
+std::unique_ptr<UCTNode> TreeFile::load(const std::string& tree_file,
+                                        const GameState& state,
+                                        std::unique_ptr<GameState>& rootstate) {
+    using namespace boost::interprocess;
+
+    std::unique_ptr<mapped_region> region;
+    try {
+        auto file = file_mapping(tree_file.c_str(), read_only);
+        region = std::make_unique<mapped_region>(file, read_only);
+    } catch (const interprocess_exception& e) {
+        myprintf("Could not map search tree %s: %s\n",
+                 tree_file.c_str(), e.what());
+        return nullptr;
+    }
+
+    const auto data = static_cast<const char*>(region->get_address());
+    const auto bytes = region->get_size();
+    auto header = Header{};
+    if (bytes >= sizeof(header)) {
+        std::memcpy(&header, data, sizeof(header));
+    }
+    if (bytes < sizeof(header)
+        || std::memcmp(header.magic, TREE_MAGIC, sizeof(header.magic)) != 0
+        || header.count == 0
+        || bytes != sizeof(header) + size_t(header.count) * sizeof(Record)) {
+        myprintf("%s is not a valid search tree.\n", tree_file.c_str());
+        return nullptr;
+    }
+    if (header.board_size != BOARD_SIZE) {
+        myprintf("Search tree %s is for board size %u.\n",
+                 tree_file.c_str(), header.board_size);
+        return nullptr;
+    }
+
+    /// 只要是当前对局中已经走过的局面就行, 之后update_root会走到当前局面
+    auto treestate = std::make_unique<GameState>(state);
+    while (treestate->get_movenum() > header.movenum
+           && treestate->undo_move()) {
+    }
+    if (treestate->get_movenum() != header.movenum
+        || treestate->board.get_hash() != header.hash) {
+        myprintf("Search tree %s is not from this game.\n", tree_file.c_str());
+        return nullptr;
+    }
+
+    const auto records = reinterpret_cast<const Record*>(data + sizeof(header));
+    auto root = std::make_unique<UCTNode>(records[0].move, records[0].policy);
+    if (!read_tree(records, header.count, *root)) {
+        myprintf("%s is not a valid search tree.\n", tree_file.c_str());
+        return nullptr;
+    }
+    myprintf("Tree: %u nodes, %d visits read from %s.\n",
+             header.count, root->get_visits(), tree_file.c_str());
+    rootstate = std::move(treestate);
+    return root;
+}
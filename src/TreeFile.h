@@ -0,0 +1,97 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#ifndef TREEFILE_H_INCLUDED
+#define TREEFILE_H_INCLUDED
+
+#include "config.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "GameState.h"
+#include "UCTNode.h"
+
+/*
+    Search tree on disk, so a long analysis survives a restart.
+
+    The file is a header followed by one fixed size record per node in
+    breadth first order, which puts the children of a node in one run of
+    records. A node's record holds where that run starts, so any subtree
+    can be read from the mapped file without looking at the rest.
+    Children that were never visited are rebuilt as uninflated pointers.
+*/
+class TreeFile {
+public:
+    /// 保存root下面的整棵树, state是root的局面
+    static bool save(const std::string& tree_file,
+                     const UCTNode& root, const GameState& state);
+
+    // Maps tree_file and rebuilds its tree if it was saved at state or
+    // at an earlier position of the same game. rootstate gets the
+    // position of the loaded root.
+    static std::unique_ptr<UCTNode> load(const std::string& tree_file,
+                                         const GameState& state,
+                                         std::unique_ptr<GameState>& rootstate);
+
+private:
+    struct Header {
+        char magic[8];
+        std::uint32_t board_size;
+        std::uint32_t movenum;
+        std::uint64_t hash;
+        std::uint32_t count;
+        std::uint32_t padding;
+    };
+    struct Record {
+        double blackevals;
+        std::int32_t visits;
+        float policy;
+        float net_eval;
+        float squared_eval_diff;
+        float min_psa_ratio;
+        std::uint32_t first_child;
+        std::uint32_t children;
+        std::int16_t move;
+        std::uint8_t status;
+        std::uint8_t proven;
+    };
+
+    static Record to_record(const UCTNodePointer& child);
+    static Record to_record(const UCTNode& node);
+    // Checks a record and sets node's stats from it, not its children.
+    static bool read_node(const Record& record, UCTNode& node);
+    // Rebuilds the whole tree below root from the records, in file order.
+    static bool read_tree(const Record* records, std::uint32_t count,
+                          UCTNode& root);
+};
+
+#endif
@@ -0,0 +1,357 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include "config.h"
+#include "UCTChildStats.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "FastBoard.h"
+#include "UCTNodePointer.h"
+
+namespace {
+
+// Vector width the fields are padded to.
+constexpr auto LANES = std::size_t{8};
+// Header words: the number of children and the padded size.
+constexpr auto HEADER = LANES;
+
+// Added to the score of a proven child, and of one that is pruned.
+constexpr auto PROVEN_BONUS = 1e30f;
+constexpr auto PRUNED_PENALTY = -1e38f;
+
+static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t),
+              "fields are read as plain arrays");
+
+std::uint32_t to_bits(float f) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &f, sizeof(bits));
+    return bits;
+}
+
+float from_bits(std::uint32_t bits) {
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+}
+
+UCTChildStats::~UCTChildStats() {
+    if (m_data) {
+        UCTNodePointer::decrement_tree_size(get_bytes());
+    }
+}
+
+std::size_t UCTChildStats::size() const {
+    return m_data ? m_data[0].load(std::memory_order_relaxed) : 0;
+}
+
+std::size_t UCTChildStats::get_padded_size() const {
+    return m_data ? m_data[1].load(std::memory_order_relaxed) : 0;
+}
+
+std::size_t UCTChildStats::get_bytes() const {
+    return (HEADER + FIELDS * get_padded_size()) * sizeof(std::uint32_t);
+}
+
+std::atomic<std::uint32_t>* UCTChildStats::get_field(Field field) const {
+    return m_data.get() + HEADER + field * get_padded_size();
+}
+
+void UCTChildStats::resize(std::size_t count) {
+    if (m_data) {
+        UCTNodePointer::decrement_tree_size(get_bytes());
+        m_data.reset();
+    }
+    if (count == 0) {
+        return;
+    }
+    const auto padded = (count + LANES - 1) / LANES * LANES;
+    const auto words = HEADER + FIELDS * padded;
+    m_data.reset(new std::atomic<std::uint32_t>[words]);
+    for (auto i = size_t{0}; i < words; i++) {
+        m_data[i].store(0, std::memory_order_relaxed);
+    }
+    m_data[0] = static_cast<std::uint32_t>(count);
+    m_data[1] = static_cast<std::uint32_t>(padded);
+    // The padding never wins.
+    const auto pruned = get_field(PRUNED);
+    for (auto i = size_t{0}; i < padded; i++) {
+        pruned[i].store(to_bits(PRUNED_PENALTY), std::memory_order_relaxed);
+    }
+    UCTNodePointer::increment_tree_size(get_bytes());
+}
+
+void UCTChildStats::set(std::size_t index, float policy, int visits,
+                        double blackevals, float proven, bool active) {
+    assert(index < size());
+    const auto relaxed = std::memory_order_relaxed;
+    get_field(POLICY)[index].store(to_bits(policy), relaxed);
+    get_field(VISITS)[index].store(static_cast<std::uint32_t>(visits), relaxed);
+    get_field(BLACKEVALS)[index].store(
+        to_bits(static_cast<float>(blackevals)), relaxed);
+    get_field(PROVEN)[index].store(to_bits(proven), relaxed);
+    get_field(PRUNED)[index].store(
+        to_bits(active ? 0.0f : PRUNED_PENALTY), relaxed);
+}
+
+void UCTChildStats::set_shared(std::size_t index, float policy,
+                               float blackeval, float proven, bool active) {
+    assert(index < size());
+    const auto relaxed = std::memory_order_relaxed;
+    const auto visits = get_field(VISITS)[index].load(relaxed);
+    get_field(POLICY)[index].store(to_bits(policy), relaxed);
+    get_field(BLACKEVALS)[index].store(to_bits(visits * blackeval), relaxed);
+    get_field(PROVEN)[index].store(to_bits(proven), relaxed);
+    get_field(PRUNED)[index].store(
+        to_bits(active ? 0.0f : PRUNED_PENALTY), relaxed);
+}
+
+void UCTChildStats::add_virtual_loss(std::size_t index, int count) {
+    assert(index < size());
+    get_field(VIRTUAL_LOSS)[index].fetch_add(static_cast<std::uint32_t>(count),
+                                             std::memory_order_relaxed);
+}
+
+void UCTChildStats::add_visit(std::size_t index, float blackeval) {
+    assert(index < size());
+    const auto relaxed = std::memory_order_relaxed;
+    get_field(VISITS)[index].fetch_add(1, relaxed);
+    auto& blackevals = get_field(BLACKEVALS)[index];
+    auto old_bits = blackevals.load(relaxed);
+    while (!blackevals.compare_exchange_weak(
+               old_bits, to_bits(from_bits(old_bits) + blackeval), relaxed)) {}
+}
+
+int UCTChildStats::get_visits(std::size_t index, int virtual_loss_count) const {
+    assert(index < size());
+    const auto relaxed = std::memory_order_relaxed;
+    const auto visits = get_field(VISITS)[index].load(relaxed);
+    const auto virtual_loss = get_field(VIRTUAL_LOSS)[index].load(relaxed);
+    return static_cast<int>(visits)
+           + static_cast<int>(virtual_loss) / virtual_loss_count;
+}
+
+void UCTChildStats::get_stats(std::size_t index, int& visits,
+                              double& blackevals) const {
+    assert(index < size());
+    const auto relaxed = std::memory_order_relaxed;
+    visits = static_cast<int>(get_field(VISITS)[index].load(relaxed));
+    blackevals = from_bits(get_field(BLACKEVALS)[index].load(relaxed));
+}
+
+// The kernels below read the fields as plain arrays. A value that changes
+// underneath us is at worst one update old, which selection shrugs off
+// just like it does with the atomics in the nodes themselves.
+
+#ifdef __AVX2__
+
+static const float* as_floats(const std::atomic<std::uint32_t>* field) {
+    return reinterpret_cast<const float*>(field);
+}
+
+static const __m256i* as_ints(const std::atomic<std::uint32_t>* field) {
+    return reinterpret_cast<const __m256i*>(field);
+}
+
+void UCTChildStats::get_totals(int& visits, float& visited_policy) const {
+    const auto policy = as_floats(get_field(POLICY));
+    const auto child_visits = get_field(VISITS);
+    auto visit_sum = _mm256_setzero_si256();
+    auto policy_sum = _mm256_setzero_ps();
+    for (auto i = size_t{0}; i < get_padded_size(); i += LANES) {
+        const auto n = _mm256_loadu_si256(as_ints(child_visits + i));
+        const auto visited = _mm256_castsi256_ps(
+            _mm256_cmpgt_epi32(n, _mm256_setzero_si256()));
+        visit_sum = _mm256_add_epi32(visit_sum, n);
+        policy_sum = _mm256_add_ps(policy_sum,
+            _mm256_and_ps(visited, _mm256_loadu_ps(policy + i)));
+    }
+    alignas(32) int visit_lanes[LANES];
+    alignas(32) float policy_lanes[LANES];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(visit_lanes), visit_sum);
+    _mm256_store_ps(policy_lanes, policy_sum);
+    visits = 0;
+    visited_policy = 0.0f;
+    for (auto i = size_t{0}; i < LANES; i++) {
+        visits += visit_lanes[i];
+        visited_policy += policy_lanes[i];
+    }
+}
+
+std::size_t UCTChildStats::select(int color, float fpu_eval,
+                                  float expanding_eval,
+                                  float puct_scale) const {
+    assert(size() > 0);
+    const auto policy = as_floats(get_field(POLICY));
+    const auto child_visits = get_field(VISITS);
+    const auto blackevals = as_floats(get_field(BLACKEVALS));
+    const auto virtual_loss = get_field(VIRTUAL_LOSS);
+    const auto proven = as_floats(get_field(PROVEN));
+    const auto pruned = as_floats(get_field(PRUNED));
+
+    const auto zero = _mm256_setzero_ps();
+    const auto one = _mm256_set1_ps(1.0f);
+    const auto white = color == FastBoard::WHITE;
+    const auto is_white = white ? _mm256_castsi256_ps(_mm256_set1_epi32(-1))
+                                : zero;
+    const auto bonus = _mm256_set1_ps(white ? -PROVEN_BONUS : PROVEN_BONUS);
+    const auto fpu = _mm256_set1_ps(fpu_eval);
+    const auto expanding = _mm256_set1_ps(expanding_eval);
+    const auto scale = _mm256_set1_ps(puct_scale);
+
+    auto best_value = _mm256_set1_ps(std::numeric_limits<float>::lowest());
+    auto best_index = _mm256_setzero_si256();
+    auto index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const auto step = _mm256_set1_epi32(LANES);
+    for (auto i = size_t{0}; i < get_padded_size(); i += LANES) {
+        const auto n = _mm256_cvtepi32_ps(
+            _mm256_loadu_si256(as_ints(child_visits + i)));
+        const auto vl = _mm256_cvtepi32_ps(
+            _mm256_loadu_si256(as_ints(virtual_loss + i)));
+        const auto b = _mm256_loadu_ps(blackevals + i);
+        // Virtual losses count as losses for the side to move.
+        const auto wins = _mm256_blendv_ps(b, _mm256_sub_ps(n, b), is_white);
+        const auto eval = _mm256_div_ps(wins,
+            _mm256_max_ps(_mm256_add_ps(n, vl), one));
+        const auto unvisited = _mm256_blendv_ps(fpu, expanding,
+            _mm256_cmp_ps(vl, zero, _CMP_GT_OQ));
+        const auto winrate = _mm256_blendv_ps(unvisited, eval,
+            _mm256_cmp_ps(n, zero, _CMP_GT_OQ));
+        const auto puct = _mm256_div_ps(
+            _mm256_mul_ps(scale, _mm256_loadu_ps(policy + i)),
+            _mm256_add_ps(one, n));
+        auto value = _mm256_add_ps(winrate, puct);
+        value = _mm256_add_ps(value,
+            _mm256_mul_ps(bonus, _mm256_loadu_ps(proven + i)));
+        value = _mm256_add_ps(value, _mm256_loadu_ps(pruned + i));
+
+        const auto better = _mm256_cmp_ps(value, best_value, _CMP_GT_OQ);
+        best_value = _mm256_blendv_ps(best_value, value, better);
+        best_index = _mm256_castps_si256(_mm256_blendv_ps(
+            _mm256_castsi256_ps(best_index), _mm256_castsi256_ps(index),
+            better));
+        index = _mm256_add_epi32(index, step);
+    }
+
+    alignas(32) float values[LANES];
+    alignas(32) int indices[LANES];
+    _mm256_store_ps(values, best_value);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(indices), best_index);
+    // Ties go to the first child, like a plain scan would do.
+    auto best = size_t{0};
+    for (auto i = size_t{1}; i < LANES; i++) {
+        if (values[i] > values[best]
+            || (values[i] == values[best] && indices[i] < indices[best])) {
+            best = i;
+        }
+    }
+    return indices[best];
+}
+
+#else
+
+void UCTChildStats::get_totals(int& visits, float& visited_policy) const {
+    get_totals_scalar(visits, visited_policy);
+}
+
+std::size_t UCTChildStats::select(int color, float fpu_eval,
+                                  float expanding_eval,
+                                  float puct_scale) const {
+    return select_scalar(color, fpu_eval, expanding_eval, puct_scale);
+}
+
+#endif
+
+// Written branch-free over whole lanes, so the compiler can vectorize
+// it for SSE or NEON.
+
+void UCTChildStats::get_totals_scalar(int& visits,
+                                      float& visited_policy) const {
+    const auto policy = get_field(POLICY);
+    const auto child_visits = get_field(VISITS);
+    visits = 0;
+    visited_policy = 0.0f;
+    for (auto i = size_t{0}; i < get_padded_size(); i++) {
+        const auto n = static_cast<int>(
+            child_visits[i].load(std::memory_order_relaxed));
+        visits += n;
+        visited_policy += n > 0
+            ? from_bits(policy[i].load(std::memory_order_relaxed)) : 0.0f;
+    }
+}
+
+std::size_t UCTChildStats::select_scalar(int color, float fpu_eval,
+                                         float expanding_eval,
+                                         float puct_scale) const {
+    assert(size() > 0);
+    const auto relaxed = std::memory_order_relaxed;
+    const auto policy = get_field(POLICY);
+    const auto child_visits = get_field(VISITS);
+    const auto blackevals = get_field(BLACKEVALS);
+    const auto virtual_loss = get_field(VIRTUAL_LOSS);
+    const auto proven = get_field(PROVEN);
+    const auto pruned = get_field(PRUNED);
+
+    const auto white = color == FastBoard::WHITE;
+    const auto bonus = white ? -PROVEN_BONUS : PROVEN_BONUS;
+
+    auto best = size_t{0};
+    auto best_value = std::numeric_limits<float>::lowest();
+    for (auto i = size_t{0}; i < get_padded_size(); i++) {
+        const auto n = static_cast<float>(
+            static_cast<int>(child_visits[i].load(relaxed)));
+        const auto vl = static_cast<float>(
+            static_cast<int>(virtual_loss[i].load(relaxed)));
+        const auto b = from_bits(blackevals[i].load(relaxed));
+        // Virtual losses count as losses for the side to move.
+        const auto wins = white ? n - b : b;
+        const auto eval = wins / std::max(n + vl, 1.0f);
+        const auto unvisited = vl > 0.0f ? expanding_eval : fpu_eval;
+        const auto winrate = n > 0.0f ? eval : unvisited;
+        const auto puct = puct_scale * from_bits(policy[i].load(relaxed))
+                          / (1.0f + n);
+        const auto value = winrate + puct
+                           + bonus * from_bits(proven[i].load(relaxed))
+                           + from_bits(pruned[i].load(relaxed));
+        if (value > best_value) {
+            best_value = value;
+            best = i;
+        }
+    }
+    return best;
+}
@@ -0,0 +1,106 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#ifndef UCTCHILDSTATS_H_INCLUDED
+#define UCTCHILDSTATS_H_INCLUDED
+
+#include "config.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/*
+    What selection needs to know about the children of a node, one array
+    per field. Picking a child streams through these arrays instead of
+    following a pointer per child, and the scores of all children are
+    worked out a vector at a time.
+    The arrays are a copy. The children stay authoritative, and a child
+    is copied back in whenever a simulation returns through it. Only the
+    visits through a shared child are ours, its value is still copied.
+*/
+class UCTChildStats {
+public:
+    UCTChildStats() = default;
+    ~UCTChildStats();
+    UCTChildStats(const UCTChildStats&) = delete;
+    UCTChildStats& operator=(const UCTChildStats&) = delete;
+
+    // Drops the old contents. Only while the node is being expanded.
+    void resize(std::size_t count);
+    std::size_t size() const;
+
+    // proven is the result for black: 1 a win, -1 a loss, 0 unknown or draw.
+    void set(std::size_t index, float policy, int visits, double blackevals,
+             float proven, bool active);
+    // Same for a child that other parents link to as well. Its visits are
+    // only those counted here by add_visit(), each worth its blackeval.
+    void set_shared(std::size_t index, float policy, float blackeval,
+                    float proven, bool active);
+    void add_virtual_loss(std::size_t index, int count);
+    // One more visit with blackeval, counted here without looking at the
+    // child.
+    void add_visit(std::size_t index, float blackeval);
+    // Visits of one child, counting the simulations on their way through
+    // it, each of which added virtual_loss_count.
+    int get_visits(std::size_t index, int virtual_loss_count) const;
+    // What was last set or added, without the virtual loss.
+    void get_stats(std::size_t index, int& visits, double& blackevals) const;
+
+    // Visits of all children, and the summed policy of the visited ones.
+    void get_totals(int& visits, float& visited_policy) const;
+
+    // Index of the child with the best eval + puct_scale * policy / (1 + visits).
+    // Unvisited children are scored at fpu_eval, or expanding_eval while
+    // some thread is on its way into them. A proven win is always taken and
+    // a proven loss only when nothing else is left.
+    std::size_t select(int color, float fpu_eval, float expanding_eval,
+                       float puct_scale) const;
+
+    // The plain loops behind the two above when there is no AVX2, kept
+    // in every build to check the AVX2 kernels against.
+    void get_totals_scalar(int& visits, float& visited_policy) const;
+    std::size_t select_scalar(int color, float fpu_eval, float expanding_eval,
+                              float puct_scale) const;
+
+private:
+    enum Field {
+        POLICY, VISITS, BLACKEVALS, VIRTUAL_LOSS, PROVEN, PRUNED, FIELDS
+    };
+    std::atomic<std::uint32_t>* get_field(Field field) const;
+    std::size_t get_padded_size() const;
+    std::size_t get_bytes() const;
+
+    // Header, then every field padded to a multiple of the vector width.
+    // Floats are stored by their bit pattern.
+    std::unique_ptr<std::atomic<std::uint32_t>[]> m_data;
+};
+
+#endif
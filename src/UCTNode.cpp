@@ -33,10 +33,14 @@
 #include <cstdio>
 #include <cstdint>
 #include <algorithm>
+#include <array>
+#include <chrono>
 #include <cmath>
+#include <condition_variable>
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <mutex>
 #include <numeric>
 #include <utility>
 #include <vector>
@@ -47,6 +51,8 @@
 #include "GTP.h"
 #include "GameState.h"
 #include "Network.h"
+#include "StripedStats.h"
+#include "UCTNodePool.h"
 #include "Utils.h"
 
 using namespace Utils;
@@ -54,47 +60,192 @@ using namespace Utils;
 UCTNode::UCTNode(int vertex, float policy) : m_move(vertex), m_policy(policy) {
 }
 
+UCTNode::~UCTNode() {
+    if (m_striped) {
+        StripedStats::release(m_striped);
+    }
+}
+
+void* UCTNode::operator new(std::size_t size) {
+    return UCTNodePool::allocate(size);
+}
+
+void UCTNode::operator delete(void* p) {
+    UCTNodePool::deallocate(p);
+}
+
 bool UCTNode::first_visit() const {
-    return m_visits == 0;
+    return get_visits() == 0;
+}
+
+// An own five wins on the spot, otherwise every five of the opponent has
+// to be blocked. Returns the legal moves that do either, empty if nothing
+// is forced. lost is set if the opponent has fives we can't block: two of
+// them, or one on a point forbidden to black.
+static std::vector<int> get_forced_moves(const SearchState& state,
+                                         bool& winning, bool& lost) {
+    const auto to_move = state.board.get_to_move();
+    std::vector<int> moves;
+    for (auto vertex : state.board.get_five_points(to_move)) {
+        if (state.is_move_legal(to_move, vertex)) {
+            moves.emplace_back(vertex);
+        }
+    }
+    winning = !moves.empty();
+    lost = false;
+    if (winning) {
+        return moves;
+    }
+    const auto fives = state.board.get_five_points(!to_move);
+    for (auto vertex : fives) {
+        if (state.is_move_legal(to_move, vertex)) {
+            moves.emplace_back(vertex);
+        }
+    }
+    lost = fives.size() > 1 || moves.size() < fives.size();
+    return moves;
 }
 
 bool UCTNode::create_children(Network & network,
                               std::atomic<int>& nodecount,
-                              GameState& state,
+                              SearchState& state,
                               float& eval,
-                              float min_psa_ratio) {
+                              float min_psa_ratio,
+                              ThreatStats* threat_stats) {
+    auto reply = int{FastBoard::NO_VERTEX};
+    const auto expansion = prepare_expansion(nodecount, state, eval,
+                                             min_psa_ratio, threat_stats,
+                                             reply);
+    if (expansion != Expansion::NEEDS_EVAL) {
+        return expansion == Expansion::DONE;
+    }
+
+    const auto eval_reply = reply != FastBoard::NO_VERTEX;
+    NNCache::Netresult raw_netlist;
+    try {
+        if (eval_reply) {
+            state.play_move(reply);
+        }
+        raw_netlist = network.get_output(
+            &state, Network::Ensemble::RANDOM_SYMMETRY);
+        if (eval_reply) {
+            state.undo_move();
+        }
+    } catch (NetworkHaltException&) {
+        if (eval_reply) {
+            state.undo_move();
+        }
+        expand_cancel();
+        throw;
+    }
+
+    finish_expansion(nodecount, state, raw_netlist, eval_reply, eval,
+                     min_psa_ratio);
+    return true;
+}
+
+UCTNode::Expansion UCTNode::prepare_expansion(std::atomic<int>& nodecount,
+                                              SearchState& state,
+                                              float& eval,
+                                              float min_psa_ratio,
+                                              ThreatStats* threat_stats,
+                                              int& reply) {
+    reply = FastBoard::NO_VERTEX;
     // no successors in final state
     // 双方pass游戏结束 因为这个设定的是无子可走是给出pass
 //    if (state.get_passes() >= 2) {
 //        return false;
 //    }
     if (state.has_end()) {
-        return false;
+        return Expansion::FAILED;
     }
     /// myprintf("fuck1\n");
     // acquire the lock
     if (!acquire_expanding()) {
-        return false;
+        return Expansion::FAILED;
     }
 
     // can we actually expand?
     if (!expandable(min_psa_ratio)) {
         expand_done();
-        return false;
+        return Expansion::FAILED;
     }
 
-    NNCache::Netresult raw_netlist;
-    try {
-        raw_netlist = network.get_output(
-            &state, Network::Ensemble::RANDOM_SYMMETRY);
-    } catch (NetworkHaltException&) {
-        expand_cancel();
-        throw;
+    const auto to_move = state.board.get_to_move();
+    auto winning = false;
+    auto lost = false;
+    const auto forced = get_forced_moves(state, winning, lost);
+    // Our five, or fives of the opponent that can't all be blocked: the
+    // result is known and only the forced moves become children. With
+    // nothing left to block, any legal move loses as well as another.
+    if (winning || lost) {
+        std::vector<Network::PolicyVertexPair> nodelist;
+        for (auto vertex : forced) {
+            nodelist.emplace_back(1.0f / forced.size(), vertex);
+        }
+        if (forced.empty()) {
+            const auto& legal = state.get_legal_mask(to_move);
+            for (auto i = 0; i < NUM_INTERSECTIONS; i++) {
+                if (legal[i]) {
+                    nodelist.emplace_back(1.0f / legal.count(),
+                        state.board.get_vertex(i % BOARD_SIZE,
+                                               i / BOARD_SIZE));
+                }
+            }
+        }
+        m_net_eval = winning == (to_move == FastBoard::BLACK) ? 1.0f : 0.0f;
+        set_proven(m_net_eval);
+        eval = m_net_eval;
+        link_nodelist(nodecount, nodelist, min_psa_ratio);
+        update(eval);
+        expand_done();
+        return Expansion::DONE;
     }
 
-    // DCNN returns winrate as side to move
-    const auto stm_eval = raw_netlist.winrate;
+    // Try to prove the position before paying for a network eval. A proven
+    // node stays without children and is scored exactly from then on.
+    if (threat_stats && cfg_threat_nodes > 0 && !has_children()
+        && !cfg_analyze_tags.has_move_restrictions()) {
+        auto threats = ThreatSearch{state, cfg_threat_nodes, cfg_threat_depth};
+        const auto result = threats.solve();
+        threat_stats->tries++;
+        threat_stats->nodes += threats.get_nodes();
+        if (result != ThreatSearch::UNKNOWN) {
+            const auto stm_wins = result == ThreatSearch::WIN;
+            (stm_wins ? threat_stats->wins : threat_stats->losses)++;
+            const auto black_wins = stm_wins == (to_move == FastBoard::BLACK);
+            m_net_eval = black_wins ? 1.0f : 0.0f;
+            set_proven(m_net_eval);
+            eval = m_net_eval;
+            update(eval);
+            expand_done();
+            return Expansion::DONE;
+        }
+    }
+
+    // With a single forced block, the position after it is worth the same.
+    // Evaluating that one instead leaves it in the cache for the child.
+    if (forced.size() == 1 && !cfg_eval_forced) {
+        reply = forced[0];
+    }
+    return Expansion::NEEDS_EVAL;
+}
+
+void UCTNode::finish_expansion(std::atomic<int>& nodecount,
+                               const SearchState& state,
+                               const NNCache::Netresult& raw_netlist,
+                               bool eval_reply,
+                               float& eval,
+                               float min_psa_ratio) {
     const auto to_move = state.board.get_to_move();
+    auto winning = false;
+    auto lost = false;
+    const auto forced = get_forced_moves(state, winning, lost);
+    assert(!winning && !lost && forced.size() <= 1);
+
+    // DCNN returns winrate as side to move
+    const auto stm_eval =
+        eval_reply ? 1.0f - raw_netlist.winrate : raw_netlist.winrate;
     // our search functions evaluate from black's point of view
     if (to_move == FastBoard::WHITE) {
         m_net_eval = 1.0f - stm_eval;
@@ -107,14 +258,24 @@ bool UCTNode::create_children(Network & network,
     std::vector<Network::PolicyVertexPair> nodelist;
 
     auto legal_sum = 0.0f;
-    for (auto i = 0; i < NUM_INTERSECTIONS; i++) {
-        const auto x = i % BOARD_SIZE;
-        const auto y = i / BOARD_SIZE;
-        const auto vertex = state.board.get_vertex(x, y);
-        if (state.is_move_legal(to_move, vertex)) {
-            /// myprintf("has one legal\n");
-            nodelist.emplace_back(raw_netlist.policy[i], vertex);
-            legal_sum += raw_netlist.policy[i];
+    const auto& legal = state.get_legal_mask(to_move);
+    if (!forced.empty()) {
+        // Nothing but the block is worth a child.
+        nodelist.emplace_back(1.0f, forced[0]);
+        legal_sum = 1.0f;
+    } else {
+        for (auto i = 0; i < NUM_INTERSECTIONS; i++) {
+            if (!legal[i]) {
+                continue;
+            }
+            const auto x = i % BOARD_SIZE;
+            const auto y = i / BOARD_SIZE;
+            const auto vertex = state.board.get_vertex(x, y);
+            if (!cfg_analyze_tags.is_to_avoid(to_move, vertex, state.get_movenum())) {
+                /// myprintf("has one legal\n");
+                nodelist.emplace_back(raw_netlist.policy[i], vertex);
+                legal_sum += raw_netlist.policy[i];
+            }
         }
     }
 
@@ -159,7 +320,6 @@ bool UCTNode::create_children(Network & network,
     // Increment visit and assign eval.
     update(eval);
     expand_done();
-    return true;
 }
 
 void UCTNode::link_nodelist(std::atomic<int>& nodecount,
@@ -198,9 +358,11 @@ void UCTNode::link_nodelist(std::atomic<int>& nodecount,
     }
 
     m_min_psa_ratio_children = skipped_children ? min_psa_ratio : 0.0f;
+    m_child_stats.resize(m_children.size());
+    refresh_child_stats();
 }
 
-const std::vector<UCTNodePointer>& UCTNode::get_children() const {
+const UCTNodeList& UCTNode::get_children() const {
     return m_children;
 }
 
@@ -209,15 +371,25 @@ int UCTNode::get_move() const {
     return m_move;
 }
 
+// A striped node is passed by every thread, its virtual loss is only
+// kept in the parent's child stats where selection looks for it.
 void UCTNode::virtual_loss() {
-    m_virtual_loss += VIRTUAL_LOSS_COUNT;
+    if (!m_striped) {
+        m_virtual_loss += VIRTUAL_LOSS_COUNT;
+    }
 }
 
 void UCTNode::virtual_loss_undo() {
-    m_virtual_loss -= VIRTUAL_LOSS_COUNT;
+    if (!m_striped) {
+        m_virtual_loss -= VIRTUAL_LOSS_COUNT;
+    }
 }
 
 void UCTNode::update(float eval) {
+    if (m_striped) {
+        StripedStats::get(m_striped).add(eval);
+        return;
+    }
     // Cache values to avoid race conditions.
     auto old_eval = static_cast<float>(m_blackevals);
     auto old_visits = static_cast<int>(m_visits);
@@ -230,6 +402,132 @@ void UCTNode::update(float eval) {
     atomic_add(m_squared_eval_diff, delta);
 }
 
+// Value of a position shared by several parents: its own net eval plus
+// every child at its current value, weighted by the visits that went
+// through that edge, which only our child stats count. A running average would keep stale results when a
+// child improved through another parent.
+void UCTNode::update_from_children() {
+    auto visits = 1;
+    auto blackevals = double(m_net_eval);
+    for (auto i = size_t{0}; i < m_children.size(); i++) {
+        const auto& child = m_children[i];
+        if (!child.is_inflated() && !child.is_linked()) {
+            continue;
+        }
+        // Its value may have moved through another parent.
+        copy_child_stats(i);
+        auto child_visits = 0;
+        auto child_blackevals = 0.0;
+        m_child_stats.get_stats(i, child_visits, child_blackevals);
+        visits += child_visits;
+        blackevals += child_blackevals;
+    }
+    m_visits = visits;
+    m_blackevals = blackevals;
+}
+
+void UCTNode::merge_stats(const UCTNode& other, MergedStats& merged) {
+    const auto visits = other.get_visits();
+    const auto blackevals = other.get_blackevals();
+    if (visits > merged.visits) {
+        m_visits += visits - merged.visits;
+        atomic_add(m_blackevals, blackevals - merged.blackevals);
+        merged.visits = visits;
+        merged.blackevals = blackevals;
+    }
+    // A proof holds whichever tree found it.
+    if (other.is_proven() && !is_proven()) {
+        m_proven = other.m_proven.load();
+    }
+}
+
+UCTNode::MergedStats UCTNode::get_merged_stats() const {
+    auto stats = MergedStats{};
+    stats.visits = get_visits();
+    stats.blackevals = get_blackevals();
+    return stats;
+}
+
+void UCTNode::enable_striping() {
+    if (!m_striped) {
+        m_striped = StripedStats::allocate();
+    }
+}
+
+void UCTNode::deflate_children() {
+    for (auto i = size_t{0}; i < m_children.size(); i++) {
+        auto& child = m_children[i];
+        if (child.is_inflated() && !child->is_proven()) {
+            copy_child_stats(i);
+            child.deflate();
+        }
+    }
+    refresh_child_stats();
+}
+
+void UCTNode::inflate_child(std::size_t index) {
+    auto& child = m_children[index];
+    // With transpositions the search links it to its shared node instead.
+    if (child.is_inflated() || cfg_transpositions) {
+        return;
+    }
+    auto visits = 0;
+    auto blackevals = 0.0;
+    m_child_stats.get_stats(index, visits, blackevals);
+    if (child.inflate() && visits > 0) {
+        child->restore_stats(visits, blackevals);
+    }
+}
+
+void UCTNode::restore_stats(int visits, double blackevals) {
+    m_visits += visits;
+    atomic_add(m_blackevals, blackevals);
+}
+
+bool UCTNode::is_proven() const {
+    return m_proven.load() != Proven::NONE;
+}
+
+float UCTNode::get_proven_eval(int tomove) const {
+    assert(is_proven());
+    const auto proven = m_proven.load();
+    const auto eval = proven == Proven::WIN ? 1.0f
+                      : (proven == Proven::DRAW ? 0.5f : 0.0f);
+    return tomove == FastBoard::WHITE ? 1.0f - eval : eval;
+}
+
+void UCTNode::set_proven(float eval) {
+    m_proven = eval > 0.5f ? Proven::WIN
+               : (eval < 0.5f ? Proven::LOSS : Proven::DRAW);
+}
+
+// Minimax backup for the side to move: one winning move proves a win,
+// otherwise all moves have to be proven and the best of them counts.
+void UCTNode::update_proven(int color) {
+    auto all_proven = !expandable()
+                      && !cfg_analyze_tags.has_move_restrictions();
+    auto best = -1.0f;
+    for (const auto& child : m_children) {
+        if (!child.valid()) {
+            continue;
+        }
+        if (!child.is_proven()) {
+            all_proven = false;
+            continue;
+        }
+        const auto eval = child.get_proven_eval(color);
+        if (eval == 1.0f) {
+            best = eval;
+            all_proven = true;
+            break;
+        }
+        best = std::max(best, eval);
+    }
+    if (all_proven && best >= 0.0f) {
+        set_proven(color == FastBoard::WHITE ? 1.0f - best : best);
+    }
+}
+
 bool UCTNode::has_children() const {
     return m_min_psa_ratio_children <= 1.0f;
 }
@@ -254,10 +552,23 @@ void UCTNode::set_policy(float policy) {
 }
 
 float UCTNode::get_eval_variance(float default_var) const {
-    return m_visits > 1 ? m_squared_eval_diff / (m_visits - 1) : default_var;
+    const auto visits = get_visits();
+    if (visits < 2) {
+        return default_var;
+    }
+    if (m_striped) {
+        const auto squared_eval_diff =
+            StripedStats::get(m_striped).get_squared_eval_diff(
+                m_visits, m_blackevals, m_squared_eval_diff);
+        return float(squared_eval_diff / (visits - 1));
+    }
+    return m_squared_eval_diff / (visits - 1);
 }
 
 int UCTNode::get_visits() const {
+    if (m_striped) {
+        return m_visits + StripedStats::get(m_striped).get_visits();
+    }
     return m_visits;
 }
 
@@ -305,6 +616,9 @@ float UCTNode::get_net_eval(int tomove) const {
 }
 
 double UCTNode::get_blackevals() const {
+    if (m_striped) {
+        return m_blackevals + StripedStats::get(m_striped).get_blackevals();
+    }
     return m_blackevals;
 }
 
@@ -312,20 +626,15 @@ void UCTNode::accumulate_eval(float eval) {
     atomic_add(m_blackevals, double(eval));
 }
 
-UCTNode* UCTNode::uct_select_child(int color, bool is_root) {
-    wait_expanded();
+std::size_t UCTNode::uct_select_child(int color, bool is_root,
+                                      ExpandWaitStats* wait_stats) {
+    wait_expanded(wait_stats);
+    assert(m_child_stats.size() == m_children.size());
 
     // Count parentvisits manually to avoid issues with transpositions.
     auto total_visited_policy = 0.0f;
-    auto parentvisits = size_t{0};
-    for (const auto& child : m_children) {
-        if (child.valid()) {
-            parentvisits += child.get_visits();
-            if (child.get_visits() > 0) {
-                total_visited_policy += child.get_policy();
-            }
-        }
-    }
+    auto parentvisits = 0;
+    m_child_stats.get_totals(parentvisits, total_visited_policy);
 
     const auto numerator = std::sqrt(double(parentvisits) *
             std::log(cfg_logpuct * double(parentvisits) + cfg_logconst));
@@ -333,37 +642,98 @@ UCTNode* UCTNode::uct_select_child(int color, bool is_root) {
     // Estimated eval for unknown nodes = parent (not NN) eval - reduction
     const auto fpu_eval = get_raw_eval(color) - fpu_reduction;
 
-    auto best = static_cast<UCTNodePointer*>(nullptr);
-    auto best_value = std::numeric_limits<double>::lowest();
-
-    for (auto& child : m_children) {
-        if (!child.active()) {
-            continue;
+    // Someone else expanding a child makes it the last choice,
+    // because we'd block on it.
+    const auto index = m_child_stats.select(color, fpu_eval,
+                                            -1.0f - fpu_reduction,
+                                            cfg_puct * numerator);
+    inflate_child(index);
+    m_child_stats.add_virtual_loss(index, VIRTUAL_LOSS_COUNT);
+    return index;
+}
+
+std::size_t UCTNode::share_select_child(
+        const std::vector<std::pair<std::size_t, float>>& shares,
+        ExpandWaitStats* wait_stats) {
+    wait_expanded(wait_stats);
+    assert(!shares.empty());
+
+    auto index = shares.front().first;
+    auto best = std::numeric_limits<float>::max();
+    for (const auto& share : shares) {
+        const auto visits =
+            m_child_stats.get_visits(share.first, VIRTUAL_LOSS_COUNT);
+        const auto ratio = visits / share.second;
+        if (ratio < best) {
+            best = ratio;
+            index = share.first;
         }
-
-        auto winrate = fpu_eval;
-        if (child.is_inflated() && child->m_expand_state.load() == ExpandState::EXPANDING) {
-            // Someone else is expanding this node, never select it
-            // if we can avoid so, because we'd block on it.
-            winrate = -1.0f - fpu_reduction;
-        } else if (child.get_visits() > 0) {
-            winrate = child.get_eval(color);
+    }
+    inflate_child(index);
+    m_child_stats.add_virtual_loss(index, VIRTUAL_LOSS_COUNT);
+    return index;
+}
+
+void UCTNode::update_child(std::size_t index, bool updated, float blackeval) {
+    // Copying a striped child means reading all of its stripes, which
+    // every other thread is writing to. Count the visit in our copy and
+    // read the child only every so often, or when its proof changes.
+    static thread_local auto s_striped_updates = 0;
+    if (m_children[index].is_linked()) {
+        // Nobody else counts the visits through this edge.
+        if (updated) {
+            m_child_stats.add_visit(index, blackeval);
         }
-        const auto psa = child.get_policy();
-        const auto denom = 1.0 + child.get_visits();
-        const auto puct = cfg_puct * psa * (numerator / denom);
-        const auto value = winrate + puct;
-        assert(value > std::numeric_limits<double>::lowest());
-
-        if (value > best_value) {
-            best_value = value;
-            best = &child;
+        copy_child_stats(index);
+    } else if (m_striped && !m_children[index]->is_proven()
+        && ++s_striped_updates % STRIPED_REFRESH_INTERVAL != 0) {
+        if (updated) {
+            m_child_stats.add_visit(index, blackeval);
         }
+    } else {
+        copy_child_stats(index);
     }
+    m_child_stats.add_virtual_loss(index, -VIRTUAL_LOSS_COUNT);
+}
 
-    assert(best != nullptr);
-    best->inflate();
-    return best->get();
+void UCTNode::refresh_child_stats() {
+    for (auto i = size_t{0}; i < m_children.size(); i++) {
+        copy_child_stats(i);
+    }
+}
+
+void UCTNode::copy_child_stats(std::size_t index) {
+    const auto& child = m_children[index];
+    auto visits = 0;
+    auto blackevals = 0.0;
+    auto proven = 0.0f;
+    if (child.is_linked()) {
+        // Our visits, at the value the shared node has now.
+        auto blackeval = 0.0f;
+        const auto child_visits = child->get_visits();
+        if (child->is_proven()) {
+            blackeval = child->get_proven_eval(FastBoard::BLACK);
+            proven = 2.0f * blackeval - 1.0f;
+        } else if (child_visits > 0) {
+            blackeval = float(child->get_blackevals() / child_visits);
+        }
+        m_child_stats.set_shared(index, child.get_policy(), blackeval,
+                                 proven, child.active());
+        return;
+    }
+    if (child.is_inflated()) {
+        blackevals = child->get_blackevals();
+        if (child->is_proven()) {
+            proven = 2.0f * child->get_proven_eval(FastBoard::BLACK) - 1.0f;
+        }
+        // Superko children don't count towards the parent's visits.
+        visits = child.valid() ? child.get_visits() : 0;
+    } else {
+        // What a deflated child had, see deflate_children().
+        m_child_stats.get_stats(index, visits, blackevals);
+    }
+    m_child_stats.set(index, child.get_policy(), visits, blackevals,
+                      proven, child.active());
 }
 
 class NodeComp : public std::binary_function<UCTNodePointer&,
@@ -376,6 +746,13 @@ public:
     // contexts (e.g., UCTSearch::get_pv()) so beware of race conditions
     bool operator()(const UCTNodePointer& a,
                     const UCTNodePointer& b) {
+        // Proven wins first and proven losses last, whatever the visits.
+        auto a_proven = a.is_proven() ? a.get_proven_eval(m_color) : 0.5f;
+        auto b_proven = b.is_proven() ? b.get_proven_eval(m_color) : 0.5f;
+        if (a_proven != b_proven) {
+            return a_proven < b_proven;
+        }
+
         auto a_visit = a.get_visits();
         auto b_visit = b.get_visits();
 
@@ -414,7 +791,8 @@ private:
 };
 
 void UCTNode::sort_children(int color, float lcb_min_visits) {
-    std::stable_sort(rbegin(m_children), rend(m_children), NodeComp(color, lcb_min_visits));
+    std::stable_sort(m_children.rbegin(), m_children.rend(), NodeComp(color, lcb_min_visits));
+    refresh_child_stats();
 }
 
 UCTNode& UCTNode::get_best_root_child(int color) {
@@ -427,7 +805,7 @@ UCTNode& UCTNode::get_best_root_child(int color) {
         max_visits = std::max(max_visits, node.get_visits());
     }
 
-    auto ret = std::max_element(begin(m_children), end(m_children),
+    auto ret = std::max_element(m_children.begin(), m_children.end(),
                                 NodeComp(color, cfg_lcb_min_visit_ratio * max_visits));
     ret->inflate();
 
@@ -478,16 +856,79 @@ void UCTNode::expand_done() {
     (void)v;
 #endif
     assert(v == ExpandState::EXPANDING);
+    wake_waiters();
 }
+void UCTNode::cancel_expansion() {
+    expand_cancel();
+}
+
 void UCTNode::expand_cancel() {
     auto v = m_expand_state.exchange(ExpandState::INITIAL);
 #ifdef NDEBUG
     (void)v;
 #endif
     assert(v == ExpandState::EXPANDING);
+    wake_waiters();
+}
+
+// Sleeping threads wait on one of a few condition variables picked by the
+// address of the node, so UCTNode itself doesn't grow.
+namespace {
+    struct WaitBucket {
+        std::mutex mutex;
+        std::condition_variable condvar;
+        std::atomic<int> waiters{0};
+    };
+    std::array<WaitBucket, 64> s_wait_buckets;
+
+    WaitBucket& get_wait_bucket(const void* node) {
+        const auto key = reinterpret_cast<std::uintptr_t>(node) / sizeof(void*);
+        return s_wait_buckets[key % s_wait_buckets.size()];
+    }
+
+    // A few microseconds of pause instructions, enough for an
+    // expansion that doesn't need the network.
+    constexpr auto EXPAND_SPIN_COUNT = 256;
 }
-void UCTNode::wait_expanded() {
-    while (m_expand_state.load() == ExpandState::EXPANDING) {}
+
+void UCTNode::wake_waiters() {
+    // The state was changed before this load, and a waiter registers before
+    // checking the state, so either it sees the change or we see it.
+    auto& bucket = get_wait_bucket(this);
+    if (bucket.waiters.load() > 0) {
+        std::lock_guard<std::mutex> lock(bucket.mutex);
+        bucket.condvar.notify_all();
+    }
+}
+
+void UCTNode::wait_expanded(ExpandWaitStats* wait_stats) {
+    if (m_expand_state.load() == ExpandState::EXPANDING) {
+        const auto start = std::chrono::steady_clock::now();
+        auto parked = false;
+        auto spins = 0;
+        while (m_expand_state.load(std::memory_order_relaxed) == ExpandState::EXPANDING
+               && spins < EXPAND_SPIN_COUNT) {
+            SMP::cpu_relax();
+            spins++;
+        }
+        if (m_expand_state.load() == ExpandState::EXPANDING) {
+            parked = true;
+            auto& bucket = get_wait_bucket(this);
+            std::unique_lock<std::mutex> lock(bucket.mutex);
+            bucket.waiters++;
+            bucket.condvar.wait(lock, [this]{
+                return m_expand_state.load() != ExpandState::EXPANDING;
+            });
+            bucket.waiters--;
+        }
+        if (wait_stats) {
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            wait_stats->waits++;
+            wait_stats->parks += parked;
+            wait_stats->wait_us += std::chrono::duration_cast<
+                std::chrono::microseconds>(elapsed).count();
+        }
+    }
     auto v = m_expand_state.load();
 #ifdef NDEBUG
     (void)v;
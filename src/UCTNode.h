@@ -39,35 +39,99 @@
 #include <cstring>
 
 #include "GameState.h"
+#include "SearchState.h"
 #include "Network.h"
 #include "SMP.h"
+#include "ThreatSearch.h"
+#include "UCTChildStats.h"
 #include "UCTNodePointer.h"
 
+// How often threads found a node still being expanded by another thread,
+// kept per search by UCTSearch.
+struct ExpandWaitStats {
+    std::atomic<int> waits{0};
+    // waits that spun out and went to sleep
+    std::atomic<int> parks{0};
+    std::atomic<std::int64_t> wait_us{0};
+
+    void clear() {
+        waits = 0;
+        parks = 0;
+        wait_us = 0;
+    }
+};
+
 class UCTNode {
+    // Saves and restores the stats below.
+    friend class TreeFile;
+    friend class UCTNodePointer;
 public:
     // When we visit a node, add this amount of virtual losses
     // to it to encourage other CPUs to explore other parts of the
     // search tree.
     static constexpr auto VIRTUAL_LOSS_COUNT = 3;
+    // A thread copies a striped child into the parent's child stats every
+    // this many updates, and counts the visits there itself in between.
+    static constexpr auto STRIPED_REFRESH_INTERVAL = 16;
     // Defined in UCTNode.cpp
     explicit UCTNode(int vertex, float policy);
     UCTNode() = delete;
-    ~UCTNode() = default;
+    ~UCTNode();
+
+    // Nodes live in UCTNodePool slabs instead of on the general heap.
+    static void* operator new(std::size_t size);
+    static void operator delete(void* p);
 
     bool create_children(Network & network,
                          std::atomic<int>& nodecount,
-                         GameState& state, float& eval,
-                         float min_psa_ratio = 0.0f);
+                         SearchState& state, float& eval,
+                         float min_psa_ratio = 0.0f,
+                         ThreatStats* threat_stats = nullptr);
 
-    const std::vector<UCTNodePointer>& get_children() const;
+    // create_children() in two steps, so the network eval can be batched
+    // with other leaves. prepare_expansion() takes the expansion lock and
+    // does everything that needs no network. On NEEDS_EVAL the lock is
+    // still held, and the caller evaluates the position, or the position
+    // after reply if that isn't NO_VERTEX, then calls finish_expansion()
+    // or cancel_expansion().
+    enum class Expansion { FAILED, DONE, NEEDS_EVAL };
+    Expansion prepare_expansion(std::atomic<int>& nodecount,
+                                SearchState& state, float& eval,
+                                float min_psa_ratio, ThreatStats* threat_stats,
+                                int& reply);
+    void finish_expansion(std::atomic<int>& nodecount,
+                          const SearchState& state,
+                          const NNCache::Netresult& raw_netlist,
+                          bool eval_reply, float& eval,
+                          float min_psa_ratio);
+    void cancel_expansion();
+
+    const UCTNodeList& get_children() const;
     void sort_children(int color, float lcb_min_visits);
     UCTNode& get_best_root_child(int color);
-    UCTNode* uct_select_child(int color, bool is_root);
+    // Returns the index of the child to visit, inflated and with a
+    // virtual loss. update_child() takes the virtual loss back. Waits
+    // for another thread's expansion are counted in wait_stats.
+    std::size_t uct_select_child(int color, bool is_root,
+                                 ExpandWaitStats* wait_stats = nullptr);
+    // Like uct_select_child(), but out of the (index, share) pairs in
+    // shares, the child furthest below its share of the visits.
+    std::size_t share_select_child(
+        const std::vector<std::pair<std::size_t, float>>& shares,
+        ExpandWaitStats* wait_stats = nullptr);
+    // updated is whether the simulation backed blackeval up through the
+    // child.
+    void update_child(std::size_t index, bool updated, float blackeval);
+    void refresh_child_stats();
 
     size_t count_nodes_and_clear_expand_state();
     bool first_visit() const;
     bool has_children() const;
     bool expandable(const float min_psa_ratio = 0.0f) const;
+    bool is_proven() const;
+    float get_proven_eval(int tomove) const;
+    void set_proven(float eval);
+    void update_proven(int color);
     void invalidate();
     void set_active(const bool active);
     bool valid() const;
@@ -83,18 +147,38 @@ public:
     void virtual_loss();
     void virtual_loss_undo();
     void update(float eval);
+    void update_from_children();
+    // What another tree's copy of this node has gained since the last
+    // merge, for root parallel search.
+    struct MergedStats {
+        int visits{0};
+        double blackevals{0.0};
+    };
+    void merge_stats(const UCTNode& other, MergedStats& merged);
+    // Our stats as if they had just been merged.
+    MergedStats get_merged_stats() const;
+    // Updates go to per-thread stripes from now on, for the nodes every
+    // simulation goes through.
+    void enable_striping();
     float get_eval_lcb(int color) const;
 
     // Defined in UCTNodeRoot.cpp, only to be called on m_root in UCTSearch
     void randomize_first_proportionally();
+    // For a move picked some other way than sort_children().
+    void set_first_child(int move);
     void prepare_root_node(Network & network, int color,
                            std::atomic<int>& nodecount,
-                           GameState& state);
+                           GameState& state, bool noise);
 
     UCTNode* get_first_child() const;
     UCTNode* get_nopass_child(FastState& state) const;
     std::unique_ptr<UCTNode> find_child(const int move);
     void inflate_all_children();
+    // Turns the children back into move/prior pairs. Our own stats stay,
+    // proven children are kept, and the visits and value of the others
+    // are kept in our child stats until they are inflated again. Only
+    // while no search is running.
+    void deflate_children();
 
     void clear_expand_state();
 private:
@@ -110,6 +194,11 @@ private:
     void accumulate_eval(float eval);
     /// void kill_superkos(const GameState& state);
     void dirichlet_noise(float epsilon, float alpha);
+    void copy_child_stats(std::size_t index);
+    // Inflates a child, which starts from what it had when it was
+    // deflated.
+    void inflate_child(std::size_t index);
+    void restore_stats(int visits, double blackevals);
 
     // Note : This class is very size-sensitive as we are going to create
     // tens of millions of instances of these.  Please put extra caution
@@ -128,8 +217,16 @@ private:
     // Initialized to small non-zero value to avoid accidental zero variances
     // at low visits.
     std::atomic<float> m_squared_eval_diff{1e-4f};
+    // StripedStats adding to the three above, 0 if none. Fits the padding
+    // in front of m_blackevals.
+    std::uint32_t m_striped{0};
     std::atomic<double> m_blackevals{0.0};
     std::atomic<Status> m_status{ACTIVE};
+    // Game result once it is known for sure, from black's point of view.
+    enum class Proven : std::uint8_t {
+        NONE, LOSS, DRAW, WIN
+    };
+    std::atomic<Proven> m_proven{Proven::NONE};
 
     // m_expand_state acts as the lock for m_children.
     // see manipulation methods below for possible state transition
@@ -150,7 +247,9 @@ private:
 
     // Tree data
     std::atomic<float> m_min_psa_ratio_children{2.0f};
-    std::vector<UCTNodePointer> m_children;
+    UCTNodeList m_children;
+    // Copy of what selection needs from m_children, in the same order.
+    UCTChildStats m_child_stats;
 
     //  m_expand_state manipulation methods
     // INITIAL -> EXPANDING
@@ -163,8 +262,10 @@ private:
     // EXPANDING -> INITIAL
     void expand_cancel();
 
-    // wait until we are on EXPANDED state
-    void wait_expanded();
+    // wait until we are on EXPANDED state, spinning for a short while and
+    // then sleeping until expand_done() or expand_cancel() wakes us
+    void wait_expanded(ExpandWaitStats* wait_stats = nullptr);
+    void wake_waiters();
 };
 
 #endif
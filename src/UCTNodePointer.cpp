@@ -32,7 +32,9 @@
 #include <atomic>
 #include <memory>
 #include <cassert>
+#include <cstdint>
 #include <cstring>
+#include <new>
 
 #include "UCTNode.h"
 
@@ -57,6 +59,9 @@ UCTNodePointer::~UCTNodePointer() {
     if (is_inflated(v)) {
         delete read_ptr(v);
         sz += sizeof(UCTNode);
+    } else if ((v & 3ULL) == LINK) {
+        delete read_link(v);
+        sz += sizeof(Link);
     }
     decrement_tree_size(sz);
 }
@@ -72,13 +77,17 @@ UCTNodePointer::UCTNodePointer(UCTNodePointer&& n) {
     increment_tree_size(sizeof(UCTNodePointer));
 }
 
-UCTNodePointer::UCTNodePointer(std::int16_t vertex, float policy) {
+std::uint64_t UCTNodePointer::pack(std::int16_t vertex, float policy) {
     std::uint32_t i_policy;
     auto i_vertex = static_cast<std::uint16_t>(vertex);
     std::memcpy(&i_policy, &policy, sizeof(i_policy));
 
-    m_data =  (static_cast<std::uint64_t>(i_policy) << 32)
-            | (static_cast<std::uint64_t>(i_vertex) << 16);
+    return (static_cast<std::uint64_t>(i_policy) << 32)
+         | (static_cast<std::uint64_t>(i_vertex) << 16);
+}
+
+UCTNodePointer::UCTNodePointer(std::int16_t vertex, float policy) {
+    m_data = pack(vertex, policy);
     increment_tree_size(sizeof(UCTNodePointer));
 }
 
@@ -89,20 +98,24 @@ UCTNodePointer& UCTNodePointer::operator=(UCTNodePointer&& n) {
     if (is_inflated(v)) {
         decrement_tree_size(sizeof(UCTNode));
         delete read_ptr(v);
+    } else if ((v & 3ULL) == LINK) {
+        decrement_tree_size(sizeof(Link));
+        delete read_link(v);
     }
     return *this;
 }
 
 UCTNode * UCTNodePointer::release() {
     auto v = std::atomic_exchange(&m_data, INVALID);
+    assert(is_inflated(v));
     decrement_tree_size(sizeof(UCTNode));
     return read_ptr(v);
 }
 
-void UCTNodePointer::inflate() const {
+bool UCTNodePointer::inflate() const {
     while (true) {
         auto v = m_data.load();
-        if (is_inflated(v)) return;
+        if ((v & 3ULL) != UNINFLATED) return false;
 
         auto v2 = reinterpret_cast<std::uint64_t>(
             new UCTNode(read_vertex(v), read_policy(v)));
@@ -111,7 +124,7 @@ void UCTNodePointer::inflate() const {
         bool success = m_data.compare_exchange_strong(v, v2);
         if (success) {
             increment_tree_size(sizeof(UCTNode));
-            return;
+            return true;
         } else {
             // this means that somebody else also modified this instance.
             // Try again next time
@@ -120,45 +133,139 @@ void UCTNodePointer::inflate() const {
     }
 }
 
+bool UCTNodePointer::link(UCTNode* node) const {
+    while (true) {
+        auto v = m_data.load();
+        if ((v & 3ULL) != UNINFLATED) return false;
+
+        auto link = new Link{node, read_policy(v), read_vertex(v)};
+        auto v2 = reinterpret_cast<std::uint64_t>(link);
+        assert((v2 & 3ULL) == 0);
+        v2 |= LINK;
+        if (m_data.compare_exchange_strong(v, v2)) {
+            increment_tree_size(sizeof(Link));
+            return true;
+        }
+        delete link;
+    }
+}
+
+void UCTNodePointer::own(std::unique_ptr<UCTNode> node) const {
+    auto v = m_data.load();
+    auto link = read_link(v);
+    assert(link->node == node.get());
+    // Whichever parent made it, it is our child now.
+    node->m_move = link->vertex;
+    node->m_policy = link->policy;
+    auto v2 = reinterpret_cast<std::uint64_t>(node.release());
+    assert((v2 & 3ULL) == 0);
+    m_data = v2 | POINTER;
+    delete link;
+    decrement_tree_size(sizeof(Link));
+    increment_tree_size(sizeof(UCTNode));
+}
+
+void UCTNodePointer::deflate() {
+    auto v = m_data.load();
+    if ((v & 3ULL) == LINK) {
+        auto link = read_link(v);
+        m_data = pack(link->vertex, link->policy);
+        delete link;
+        decrement_tree_size(sizeof(Link));
+        return;
+    }
+    if (!is_inflated(v)) return;
+
+    auto node = read_ptr(v);
+    m_data = pack(node->get_move(), node->get_policy());
+    delete node;
+    decrement_tree_size(sizeof(UCTNode));
+}
+
 bool UCTNodePointer::valid() const {
     auto v = m_data.load();
-    if (is_inflated(v)) return read_ptr(v)->valid();
+    if (has_node(v)) return read_ptr(v)->valid();
     return true;
 }
 
 int UCTNodePointer::get_visits() const {
     auto v = m_data.load();
-    if (is_inflated(v)) return read_ptr(v)->get_visits();
+    if (has_node(v)) return read_ptr(v)->get_visits();
     return 0;
 }
 
 float UCTNodePointer::get_policy() const {
     auto v = m_data.load();
     if (is_inflated(v)) return read_ptr(v)->get_policy();
+    if ((v & 3ULL) == LINK) return read_link(v)->policy;
     return read_policy(v);
 }
 
 float UCTNodePointer::get_eval_lcb(int color) const {
     auto v = m_data.load();
-    assert(is_inflated(v));
+    assert(has_node(v));
     return read_ptr(v)->get_eval_lcb(color);
 }
 
 bool UCTNodePointer::active() const {
     auto v = m_data.load();
-    if (is_inflated(v)) return read_ptr(v)->active();
+    if (has_node(v)) return read_ptr(v)->active();
     return true;
 }
 
+bool UCTNodePointer::is_proven() const {
+    auto v = m_data.load();
+    if (has_node(v)) return read_ptr(v)->is_proven();
+    return false;
+}
+
+float UCTNodePointer::get_proven_eval(int tomove) const {
+    // this can only be called if it is an inflated or linked pointer
+    auto v = m_data.load();
+    assert(has_node(v));
+    return read_ptr(v)->get_proven_eval(tomove);
+}
+
 float UCTNodePointer::get_eval(int tomove) const {
-    // this can only be called if it is an inflated pointer
+    // this can only be called if it is an inflated or linked pointer
     auto v = m_data.load();
-    assert(is_inflated(v));
+    assert(has_node(v));
     return read_ptr(v)->get_eval(tomove);
 }
 
 int UCTNodePointer::get_move() const {
     auto v = m_data.load();
     if (is_inflated(v)) return read_ptr(v)->get_move();
+    if ((v & 3ULL) == LINK) return read_link(v)->vertex;
     return read_vertex(v);
 }
+
+UCTNodeList::~UCTNodeList() {
+    for (auto& child : *this) {
+        child.~UCTNodePointer();
+    }
+    ::operator delete(m_data);
+}
+
+void UCTNodeList::reserve(std::size_t capacity) {
+    if (capacity <= m_capacity) return;
+    assert(capacity <= UINT32_MAX);
+
+    auto data = static_cast<UCTNodePointer*>(
+        ::operator new(capacity * sizeof(UCTNodePointer)));
+    for (auto i = size_t{0}; i < m_size; i++) {
+        new (&data[i]) UCTNodePointer(std::move(m_data[i]));
+        m_data[i].~UCTNodePointer();
+    }
+    ::operator delete(m_data);
+    m_data = data;
+    m_capacity = static_cast<std::uint32_t>(capacity);
+}
+
+void UCTNodeList::emplace_back(std::int16_t vertex, float policy) {
+    if (m_size == m_capacity) {
+        reserve(m_capacity ? 2 * size_t{m_capacity} : 1);
+    }
+    new (&m_data[m_size]) UCTNodePointer(vertex, policy);
+    m_size++;
+}
@@ -36,6 +36,7 @@
 #include <memory>
 #include <cassert>
 #include <cstring>
+#include <iterator>
 
 #include "SMP.h"
 
@@ -49,32 +50,53 @@ class UCTNode;
 // of:
 //  - std::unique_ptr<UCTNode> pointer;
 //  - std::pair<float, std::int16_t> args;
+//  - a link to a UCTNode owned by somebody else, see link().
 
 // All methods should be thread-safe except destructor and when
 // the instanced is 'moved from'.
 
 class UCTNodePointer {
+    // Account for their arrays in the tree size.
+    friend class UCTChildStats;
+    friend class StripedStats;
 private:
+    static constexpr std::uint64_t LINK = 3;
     static constexpr std::uint64_t INVALID = 2;
     static constexpr std::uint64_t POINTER = 1;
     static constexpr std::uint64_t UNINFLATED = 0;
 
+    // What a link points to. The args stay here, the node is shared.
+    struct Link {
+        UCTNode* node;
+        float policy;
+        std::int16_t vertex;
+    };
+
     static std::atomic<size_t> m_tree_size;
     static void increment_tree_size(size_t sz);
     static void decrement_tree_size(size_t sz);
 
     // the raw storage used here.
     // if bit [1:0] is 1, m_data is the actual pointer.
+    // if bit [1:0] is 3, m_data is a pointer to a Link.
     // if bit [1:0] is 0, bit [31:16] is the vertex value, bit [63:32] is the policy
     // if bit [1:0] is other values, it should assert-fail
     // (C-style bit fields and unions are not portable)
     mutable std::atomic<std::uint64_t> m_data{INVALID};
 
     UCTNode * read_ptr(uint64_t v) const {
+        if ((v & 3ULL) == LINK) {
+            return read_link(v)->node;
+        }
         assert((v & 3ULL) == POINTER);
         return reinterpret_cast<UCTNode*>(v & ~(0x3ULL));
     }
 
+    Link * read_link(uint64_t v) const {
+        assert((v & 3ULL) == LINK);
+        return reinterpret_cast<Link*>(v & ~(0x3ULL));
+    }
+
     std::int16_t read_vertex(uint64_t v) const {
         assert((v & 3ULL) == UNINFLATED);
         return static_cast<std::int16_t>(v >> 16);
@@ -95,6 +117,12 @@ private:
         return (v & 3ULL) == POINTER;
     }
 
+    bool has_node(uint64_t v) const {
+        return is_inflated(v) || (v & 3ULL) == LINK;
+    }
+
+    static std::uint64_t pack(std::int16_t vertex, float policy);
+
 public:
     static size_t get_tree_size();
 
@@ -107,6 +135,9 @@ public:
     bool is_inflated() const {
         return is_inflated(m_data.load());
     }
+    bool is_linked() const {
+        return (m_data.load() & 3ULL) == LINK;
+    }
 
     // methods from std::unique_ptr<UCTNode>
     typename std::add_lvalue_reference<UCTNode>::type operator*() const{
@@ -121,19 +152,81 @@ public:
     UCTNodePointer& operator=(UCTNodePointer&& n);
     UCTNode * release();
 
-    // construct UCTNode instance from the vertex/policy pair
-    void inflate() const;
+    // construct UCTNode instance from the vertex/policy pair. True if
+    // this call made it, not some other thread.
+    bool inflate() const;
+    // the other way round, dropping the node and everything below it.
+    // Not thread-safe, only for when no search is running.
+    void deflate();
+    // instead of inflating, point to a node owned by somebody else. The
+    // node is reached through get() like our own, but isn't deleted with
+    // us. True if this call made the link.
+    bool link(UCTNode* node) const;
+    // take over the node we link to, which its owner has released. It
+    // gets the move and policy of the link.
+    void own(std::unique_ptr<UCTNode> node) const;
 
     // proxy of UCTNode methods which can be called without
-    // constructing UCTNode
+    // constructing UCTNode. A link has the move and policy of its own,
+    // the rest is that of the node, whichever parent it was reached from.
     bool valid() const;
     int get_visits() const;
     float get_policy() const;
     bool active() const;
     int get_move() const;
-    // these can only be called if it is an inflated pointer
+    // these can only be called if it is an inflated or linked pointer
     float get_eval(int tomove) const;
     float get_eval_lcb(int color) const;
+    // false if neither inflated nor linked
+    bool is_proven() const;
+    float get_proven_eval(int tomove) const;
+};
+
+// The children of a UCTNode. The part of std::vector<UCTNodePointer>
+// the tree uses, with 32-bit size and capacity so that it takes 16 bytes
+// instead of 24 and a UCTNode fits in one cache line.
+// Not thread-safe, like the vector: only the expanding thread appends.
+class UCTNodeList {
+public:
+    using iterator = UCTNodePointer*;
+    using const_iterator = const UCTNodePointer*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    UCTNodeList() = default;
+    ~UCTNodeList();
+    UCTNodeList(const UCTNodeList&) = delete;
+    UCTNodeList& operator=(const UCTNodeList&) = delete;
+
+    std::size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    UCTNodePointer& operator[](std::size_t i) {
+        assert(i < m_size);
+        return m_data[i];
+    }
+    const UCTNodePointer& operator[](std::size_t i) const {
+        assert(i < m_size);
+        return m_data[i];
+    }
+    UCTNodePointer& front() { return (*this)[0]; }
+    UCTNodePointer& back() { return (*this)[m_size - 1]; }
+    const UCTNodePointer& front() const { return (*this)[0]; }
+    const UCTNodePointer& back() const { return (*this)[m_size - 1]; }
+
+    iterator begin() { return m_data; }
+    iterator end() { return m_data + m_size; }
+    const_iterator begin() const { return m_data; }
+    const_iterator end() const { return m_data + m_size; }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+
+    void reserve(std::size_t capacity);
+    void emplace_back(std::int16_t vertex, float policy);
+
+private:
+    UCTNodePointer* m_data{nullptr};
+    std::uint32_t m_size{0};
+    std::uint32_t m_capacity{0};
 };
 
 #endif
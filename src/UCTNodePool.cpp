@@ -0,0 +1,214 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include "config.h"
+#include "UCTNodePool.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "SMP.h"
+#include "UCTNode.h"
+
+namespace {
+
+constexpr auto CACHE_LINE = std::size_t{64};
+// Slots are whole cache lines, so that no node straddles two of them.
+constexpr auto SLOT_SIZE =
+    (sizeof(UCTNode) + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+// A multiple of 64 nodes keeps every slab a whole number of cache lines.
+constexpr auto SLAB_NODES = std::size_t{64 * 16};
+constexpr auto SLAB_BYTES = SLOT_SIZE * SLAB_NODES;
+// Nodes moved to or from the shared list at once.
+constexpr auto BATCH_NODES = std::size_t{1024};
+
+static_assert(SLOT_SIZE % alignof(UCTNode) == 0,
+              "every slot has to be aligned for a UCTNode");
+static_assert(SLAB_BYTES % CACHE_LINE == 0,
+              "slabs are a whole number of cache lines");
+// Not required, but a node grown past one line costs twice the memory.
+static_assert(sizeof(UCTNode) <= CACHE_LINE,
+              "a UCTNode should fit in one cache line");
+
+struct FreeNode {
+    FreeNode* next;
+};
+
+// Unlinks the first BATCH_NODES nodes of a list of count nodes.
+FreeNode* take_batch(FreeNode*& head, std::size_t& count) {
+    assert(count >= BATCH_NODES);
+    auto batch = head;
+    auto last = head;
+    for (auto i = std::size_t{1}; i < BATCH_NODES; i++) {
+        last = last->next;
+    }
+    head = last->next;
+    last->next = nullptr;
+    count -= BATCH_NODES;
+    return batch;
+}
+
+struct SharedPool {
+    SMP::Mutex mutex;
+    // each entry is a list of BATCH_NODES free nodes
+    std::vector<FreeNode*> batches;
+    // fewer than BATCH_NODES nodes left behind by exited threads
+    FreeNode* spare{nullptr};
+    std::size_t spare_count{0};
+    std::vector<std::unique_ptr<char[]>> slabs;
+    std::atomic<std::size_t> reserved_bytes{0};
+};
+
+SharedPool& shared_pool() {
+    // Never destroyed: threads may still free nodes during static destruction.
+    static auto pool = new SharedPool;
+    return *pool;
+}
+
+struct ThreadCache {
+    FreeNode* head{nullptr};
+    std::size_t count{0};
+    char* slab_next{nullptr};
+    char* slab_end{nullptr};
+
+    ~ThreadCache() {
+        // Give our free nodes and the unused rest of our slab to the
+        // threads that stay. Server connections come and go, so nothing
+        // may stay behind with a dead thread.
+        while (slab_next != slab_end) {
+            auto node = reinterpret_cast<FreeNode*>(slab_next);
+            node->next = head;
+            head = node;
+            count++;
+            slab_next += SLOT_SIZE;
+        }
+        if (!head) {
+            return;
+        }
+        auto tail = head;
+        while (tail->next) {
+            tail = tail->next;
+        }
+
+        auto& pool = shared_pool();
+        LOCK(pool.mutex, lock);
+        tail->next = pool.spare;
+        pool.spare = head;
+        pool.spare_count += count;
+        head = nullptr;
+        count = 0;
+        while (pool.spare_count >= BATCH_NODES) {
+            pool.batches.emplace_back(
+                ::take_batch(pool.spare, pool.spare_count));
+        }
+    }
+
+    FreeNode* take_batch() {
+        return ::take_batch(head, count);
+    }
+
+    void new_slab() {
+        auto& pool = shared_pool();
+        auto slab = std::unique_ptr<char[]>(new char[SLAB_BYTES + CACHE_LINE]);
+        auto address = reinterpret_cast<std::uintptr_t>(slab.get());
+        address = (address + CACHE_LINE - 1) & ~(CACHE_LINE - 1);
+        slab_next = reinterpret_cast<char*>(address);
+        slab_end = slab_next + SLAB_BYTES;
+        pool.reserved_bytes += SLAB_BYTES + CACHE_LINE;
+        LOCK(pool.mutex, lock);
+        pool.slabs.emplace_back(std::move(slab));
+    }
+};
+
+thread_local ThreadCache t_cache;
+
+}
+
+void* UCTNodePool::allocate(std::size_t size) {
+    assert(size <= SLOT_SIZE);
+    (void)size;
+    auto& cache = t_cache;
+
+    if (!cache.head && cache.slab_next == cache.slab_end) {
+        // Only here do we touch the shared state, once per batch or slab.
+        auto& pool = shared_pool();
+        {
+            LOCK(pool.mutex, lock);
+            if (!pool.batches.empty()) {
+                cache.head = pool.batches.back();
+                cache.count = BATCH_NODES;
+                pool.batches.pop_back();
+            } else if (pool.spare) {
+                cache.head = pool.spare;
+                cache.count = pool.spare_count;
+                pool.spare = nullptr;
+                pool.spare_count = 0;
+            }
+        }
+        if (!cache.head) {
+            cache.new_slab();
+        }
+    }
+
+    if (cache.head) {
+        auto node = cache.head;
+        cache.head = node->next;
+        cache.count--;
+        return node;
+    }
+    auto node = cache.slab_next;
+    cache.slab_next += SLOT_SIZE;
+    return node;
+}
+
+void UCTNodePool::deallocate(void* p) {
+    if (!p) {
+        return;
+    }
+    auto& cache = t_cache;
+    auto node = static_cast<FreeNode*>(p);
+    node->next = cache.head;
+    cache.head = node;
+    cache.count++;
+
+    if (cache.count >= 2 * BATCH_NODES) {
+        auto batch = cache.take_batch();
+        auto& pool = shared_pool();
+        LOCK(pool.mutex, lock);
+        pool.batches.emplace_back(batch);
+    }
+}
+
+std::size_t UCTNodePool::get_reserved_bytes() {
+    return shared_pool().reserved_bytes;
+}
@@ -27,39 +27,29 @@
     work.
 */
 
-#ifndef SMP_H_INCLUDED
-#define SMP_H_INCLUDED
+#ifndef UCTNODEPOOL_H_INCLUDED
+#define UCTNODEPOOL_H_INCLUDED
 
 #include "config.h"
 
 #include <cstddef>
-#include <atomic>
 
-namespace SMP {
-    size_t get_num_cpus();
-
-    class Mutex {
-    public:
-        Mutex();
-        ~Mutex() = default;
-        friend class Lock;
-    private:
-        std::atomic<bool> m_lock;
-    };
-
-    class Lock {
-    public:
-        explicit Lock(Mutex & m);
-        ~Lock();
-        void lock();
-        void unlock();
-    private:
-        Mutex * m_mutex;
-        bool m_owns_lock{false};
-    };
-}
-
-// Avoids accidentally creating a temporary
-#define LOCK(mutex, lock) SMP::Lock lock((mutex))
+/*
+    Memory for UCTNodes. Every thread carves nodes out of its own slabs and
+    keeps the nodes it frees on its own list, so inflating children doesn't
+    contend on malloc. A list that grows too long hands whole batches to a
+    shared list, which is where a thread that runs dry looks before it
+    takes a new slab. A thread that exits hands back all its free nodes and
+    the unused rest of its slab. Slabs are kept for the lifetime of the
+    process.
+*/
+class UCTNodePool {
+public:
+    static void* allocate(std::size_t size);
+    static void deallocate(void* p);
+
+    /// 所有slab占用的字节数, 包括空闲的节点
+    static std::size_t get_reserved_bytes();
+};
 
 #endif
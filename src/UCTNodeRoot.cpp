@@ -125,6 +125,7 @@ void UCTNode::dirichlet_noise(float epsilon, float alpha) {
         policy = policy * (1 - epsilon) + epsilon * eta_a;
         child->set_policy(policy);
     }
+    refresh_child_stats();
 }
 
 void UCTNode::randomize_first_proportionally() {
@@ -166,7 +167,18 @@ void UCTNode::randomize_first_proportionally() {
     assert(m_children.size() > index);
 
     // Now swap the child at index with the first child
-    std::iter_swap(begin(m_children), begin(m_children) + index);
+    std::iter_swap(m_children.begin(), m_children.begin() + index);
+    refresh_child_stats();
+}
+
+void UCTNode::set_first_child(int move) {
+    for (auto& child : m_children) {
+        if (child.get_move() == move) {
+            std::swap(child, m_children.front());
+            break;
+        }
+    }
+    refresh_child_stats();
 }
 
 UCTNode* UCTNode::get_nopass_child(FastState& state) const {
@@ -187,6 +199,10 @@ UCTNode* UCTNode::get_nopass_child(FastState& state) const {
 std::unique_ptr<UCTNode> UCTNode::find_child(const int move) {
     for (auto& child : m_children) {
         if (child.get_move() == move) {
+            // A shared node stays where it is, see UCTSearch::update_root().
+            if (child.is_linked()) {
+                return nullptr;
+            }
              // no guarantee that this is a non-inflated node
             child.inflate();
             return std::unique_ptr<UCTNode>(child.release());
@@ -206,12 +222,16 @@ void UCTNode::inflate_all_children() {
 
 void UCTNode::prepare_root_node(Network & network, int color,
                                 std::atomic<int>& nodes,
-                                GameState& root_state) {
+                                GameState& root_state, bool noise) {
     float root_eval;
     const auto had_children = has_children();
     if (expandable()) {
-        create_children(network, nodes, root_state, root_eval);
+        auto search_state = SearchState(root_state);
+        create_children(network, nodes, search_state, root_eval);
     }
+    // The root always gets searched, even if it was proven as a child.
+    // Its children's proofs put it back right away.
+    m_proven = Proven::NONE;
     if (had_children) {
         Utils::myprintf("here1\n");
         root_eval = get_net_eval(color);
@@ -226,12 +246,22 @@ void UCTNode::prepare_root_node(Network & network, int color,
     // all children of the root are inflated, so do that.
     inflate_all_children();
 
+    // Every simulation updates these. In a graph the stats of a position
+    // are added up from its children instead, so leave them be.
+    if (cfg_striping && !cfg_transpositions) {
+        enable_striping();
+        for (const auto& child : m_children) {
+            child->enable_striping();
+        }
+    }
+
     // Remove illegal moves, so the root move list is correct.
     // This also removes a lot of special cases.
     // no ko and pass in gomoku remove it
     // kill_superkos(root_state);
 
-    if (cfg_noise) {
+    // Gumbel search samples the root moves itself.
+    if (noise && !cfg_gumbel) {
         // Adjust the Dirichlet noise's alpha constant to the board size
         auto alpha = 0.03f * 361.0f / NUM_INTERSECTIONS;
         dirichlet_noise(0.25f, alpha);
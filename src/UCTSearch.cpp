@@ -39,6 +39,7 @@
 #include <limits>
 #include <memory>
 #include <type_traits>
+#include <unordered_set>
 #include <algorithm>
 
 #include "FastBoard.h"
@@ -46,9 +47,11 @@
 #include "FullBoard.h"
 #include "GTP.h"
 #include "GameState.h"
+#include "Random.h"
 #include "TimeControl.h"
 #include "Timing.h"
 #include "Training.h"
+#include "TreeFile.h"
 #include "Utils.h"
 #ifdef USE_OPENCL
 #include "OpenCLScheduler.h"
@@ -107,12 +110,58 @@ private:
 };
 
 
-UCTSearch::UCTSearch(GameState& g, Network& network)
+struct UCTSearch::SearchGroup {
+    SearchGroup(const GameState& state, Network& network,
+                std::shared_ptr<AsyncEvaluator> evaluator)
+        : rootstate(state), search(rootstate, network, evaluator) {}
+
+    GameState rootstate;
+    UCTSearch search;
+    // By child of search.m_root, what was already merged into our root.
+    std::vector<UCTNode::MergedStats> merged;
+    UCTNode::MergedStats merged_root;
+    int merged_playouts{0};
+    // Declared last so the threads are gone before the search.
+    Utils::ThreadPool pool;
+    Utils::ThreadGroup workers{pool};
+};
+
+static size_t get_root_groups() {
+    return std::max(size_t{1}, std::min(size_t(cfg_root_groups),
+                                        size_t(cfg_num_threads)));
+}
+
+// The threads of the first group are ours.
+static size_t get_group_threads(size_t group) {
+    const auto groups = get_root_groups();
+    return cfg_num_threads / groups + (group < cfg_num_threads % groups);
+}
+
+UCTSearch::UCTSearch(GameState& g, Network& network,
+                     std::shared_ptr<AsyncEvaluator> evaluator)
     : m_rootstate(g), m_network(network) {
     set_playout_limit(cfg_max_playouts);
     set_visit_limit(cfg_max_visits);
+    set_tree_searches(1);
 
     m_root = std::make_unique<UCTNode>(FastBoard::PASS, 0.0f);
+    if (cfg_transpositions) {
+        m_transpositions = std::make_unique<TranspositionTable>();
+    }
+    m_shared_evaluator = evaluator != nullptr;
+    if (m_shared_evaluator) {
+        m_evaluator = std::move(evaluator);
+    } else if (cfg_async_sims > 0) {
+        m_evaluator = std::make_shared<AsyncEvaluator>(
+            m_network, cfg_leaf_batch, cfg_eval_threads, &m_batch_stats);
+    }
+}
+
+UCTSearch::~UCTSearch() {
+    // Trees still being deleted count against the tree size.
+    for (auto& tg : m_delete_futures) {
+        tg.wait_all();
+    }
 }
 
 bool UCTSearch::advance_to_new_rootstate() {
@@ -154,21 +203,12 @@ bool UCTSearch::advance_to_new_rootstate() {
 
     // Try to replay moves advancing m_root
     for (auto i = 0; i < depth; i++) {
-        ThreadGroup tg(thread_pool);
-
         test->forward_move();
         const auto move = test->get_last_move();
 
         auto oldroot = std::move(m_root);
         m_root = oldroot->find_child(move);
-
-        // Lazy tree destruction.  Instead of calling the destructor of the
-        // old root node on the main thread, send the old root to a separate
-        // thread and destroy it from the child thread.  This will save a
-        // bit of time when dealing with large trees.
-        auto p = oldroot.release();
-        tg.add_task([p]() { delete p; });
-        m_delete_futures.push_back(std::move(tg));
+        delete_tree(std::move(oldroot));
 
         if (!m_root) {
             // Tree hasn't been expanded this far
@@ -187,34 +227,243 @@ bool UCTSearch::advance_to_new_rootstate() {
     return true;
 }
 
+// Lazy tree destruction.  Instead of calling the destructor of the
+// old root node on the main thread, send the old root to a separate
+// thread and destroy it from the child thread.  This will save a
+// bit of time when dealing with large trees.
+void UCTSearch::delete_tree(std::unique_ptr<UCTNode> root) {
+    if (!root) {
+        return;
+    }
+    ThreadGroup tg(thread_pool);
+    auto p = root.release();
+    tg.add_task([p]() { delete p; });
+    m_delete_futures.push_back(std::move(tg));
+}
+
 void UCTSearch::update_root() {
     // Definition of m_playouts is playouts per search call.
     // So reset this count now.
-    m_playouts = 0;
+    m_playouts.clear();
+    m_threat_stats.clear();
+    m_batch_stats.clear();
+    m_recycle_stats.clear();
+    m_wait_stats.clear();
+    m_halving.stop();
 
-#ifndef NDEBUG
-    auto start_nodes = m_root->count_nodes_and_clear_expand_state();
-#endif
+    // Nodes of the last search, shared ones included.
+    const auto start_nodes = m_nodes.load();
 
     if (!advance_to_new_rootstate() || !m_root) {
+        // A tree we can't reuse goes the same way as the parts we cut off.
+        delete_tree(std::move(m_root));
         m_root = std::make_unique<UCTNode>(FastBoard::PASS, 0.0f);
     }
     // Clear last_rootstate to prevent accidental use.
     m_last_rootstate.reset(nullptr);
 
+    if (m_transpositions) {
+        // Take over the shared node of the new root, if it has one.
+        auto shared = m_transpositions->release_node(m_rootstate.board.get_hash());
+        if (shared) {
+            delete_tree(std::move(m_root));
+            m_root = std::move(shared);
+        }
+        // Nothing else leads to the children of the root, so they are ours
+        // again and count their visits themselves, like in a tree.
+        for (const auto& child : m_root->get_children()) {
+            if (child.is_linked()) {
+                auto state = FastState(m_rootstate);
+                state.play_move(child.get_move());
+                child.own(m_transpositions->release_node(state.board.get_hash()));
+            }
+        }
+    }
+
     // Check how big our search tree (reused or new) is.
     m_nodes = m_root->count_nodes_and_clear_expand_state();
+    if (m_transpositions) {
+        m_nodes += m_transpositions->retain_reachable(*m_root);
+    }
 
-#ifndef NDEBUG
-    if (m_nodes > 0) {
+    if (start_nodes > 0) {
         myprintf("update_root, %d -> %d nodes (%.1f%% reused)\n",
             start_nodes, m_nodes.load(), 100.0 * m_nodes.load() / start_nodes);
     }
-#endif
+}
+
+// The workers stop by themselves when the tree is full. Wait for them, drop
+// the subtrees below the least visited nodes off the principal variation
+// until we are back at RECYCLE_TARGET, and start them again. Returns false
+// if there was nothing to drop, then the search ends as it used to.
+bool UCTSearch::recycle_tree(Utils::ThreadGroup& workers) {
+    // Shared nodes add up their value from their children, dropping those
+    // would lose it.
+    if (!cfg_recycle_tree || m_transpositions || !m_run || limits_reached()
+        || UCTNodePointer::get_tree_size() < get_max_tree_size()) {
+        return false;
+    }
+    workers.wait_all();
+
+    auto pv = std::unordered_set<const UCTNode*>{};
+    for (auto node = m_root.get(); node; ) {
+        pv.insert(node);
+        auto next = static_cast<UCTNode*>(nullptr);
+        for (const auto& child : node->get_children()) {
+            if (child.is_inflated()
+                && (!next || child.get_visits() > next->get_visits())) {
+                next = child.get();
+            }
+        }
+        node = next;
+    }
+
+    struct Candidate {
+        int visits;
+        int depth;
+        UCTNode* node;
+    };
+    auto candidates = std::vector<Candidate>{};
+    auto todo = std::vector<std::pair<UCTNode*, int>>{{m_root.get(), 0}};
+    while (!todo.empty()) {
+        const auto node = todo.back().first;
+        const auto depth = todo.back().second;
+        todo.pop_back();
+        auto has_inflated = false;
+        for (const auto& child : node->get_children()) {
+            if (child.is_inflated()) {
+                has_inflated = true;
+                todo.emplace_back(child.get(), depth + 1);
+            }
+        }
+        if (has_inflated && !pv.count(node)) {
+            candidates.push_back({node->get_visits(), depth, node});
+        }
+    }
+    // A node has at least the visits of its children, so going from few
+    // visits to many, and deep to shallow on ties, we drop the children of
+    // a node before the node itself.
+    std::sort(begin(candidates), end(candidates),
+              [](const Candidate& a, const Candidate& b) {
+                  return std::tie(a.visits, b.depth) < std::tie(b.visits, a.depth);
+              });
+
+    const auto start_size = UCTNodePointer::get_tree_size();
+    const auto target = static_cast<size_t>(get_max_tree_size() * RECYCLE_TARGET);
+    for (const auto& candidate : candidates) {
+        if (UCTNodePointer::get_tree_size() <= target) {
+            break;
+        }
+        candidate.node->deflate_children();
+    }
+    const auto end_size = UCTNodePointer::get_tree_size();
+    m_nodes = m_root->count_nodes_and_clear_expand_state();
+
+    if (end_size >= start_size || end_size >= get_max_tree_size()) {
+        return false;
+    }
+    m_recycle_stats.passes++;
+    m_recycle_stats.bytes += start_size - end_size;
+
+    for (auto i = size_t{0}; i < get_group_threads(0); i++) {
+        workers.add_task(UCTWorker(m_rootstate, this, m_root.get()));
+    }
+    return true;
+}
+
+// Every group searches from its own copy of the root, reusing its own tree
+// like we do. The threads of a group stay on one NUMA node, so are the
+// nodes they allocate.
+void UCTSearch::start_groups(int color) {
+    const auto groups = get_root_groups();
+    if (m_groups.size() + 1 != groups) {
+        m_groups.clear();
+        const auto numa_nodes = SMP::get_numa_nodes();
+        for (auto g = size_t{1}; g < groups; g++) {
+            auto group = std::make_unique<SearchGroup>(
+                m_rootstate, m_network,
+                m_shared_evaluator ? m_evaluator : nullptr);
+            auto cpus = std::vector<int>{};
+            if (numa_nodes.size() > 1) {
+                cpus = numa_nodes[g % numa_nodes.size()];
+            }
+            for (auto i = size_t{0}; i < get_group_threads(g); i++) {
+                group->pool.add_thread([cpus]() {
+                    SMP::set_thread_affinity(cpus);
+                });
+            }
+            m_groups.emplace_back(std::move(group));
+        }
+    }
+
+    for (auto g = size_t{0}; g < m_groups.size(); g++) {
+        auto& group = *m_groups[g];
+        auto& search = group.search;
+        group.rootstate = m_rootstate;
+        search.m_maxplayouts = m_maxplayouts;
+        search.m_maxvisits = m_maxvisits;
+        search.m_tree_searches = m_tree_searches;
+        search.update_root();
+        search.m_rootstate.board.set_to_move(color);
+        search.m_root->prepare_root_node(m_network, color, search.m_nodes,
+                                         search.m_rootstate,
+                                         cfg_noise && !m_fast_search);
+        // Our root has seen the visits of the reused root already, but not
+        // those of its children, which were grandchildren before.
+        group.merged.assign(search.m_root->get_children().size(), {});
+        group.merged_root = search.m_root->get_merged_stats();
+        group.merged_playouts = 0;
+
+        search.m_run = true;
+        for (auto i = size_t{0}; i < get_group_threads(g + 1); i++) {
+            group.workers.add_task(
+                UCTWorker(group.rootstate, &search, search.m_root.get()));
+        }
+    }
+}
+
+void UCTSearch::merge_groups(int color) {
+    if (m_groups.empty()) {
+        return;
+    }
+    const auto& children = m_root->get_children();
+    auto index = std::vector<int>(FastBoard::NUM_VERTICES, -1);
+    for (auto i = size_t{0}; i < children.size(); i++) {
+        index[children[i].get_move()] = i;
+    }
+    for (auto& group : m_groups) {
+        const auto& root = *group->search.m_root;
+        const auto& other = root.get_children();
+        for (auto j = size_t{0}; j < other.size(); j++) {
+            const auto i = index[other[j].get_move()];
+            if (i >= 0 && other[j].is_inflated()) {
+                children[i]->merge_stats(*other[j], group->merged[j]);
+            }
+        }
+        m_root->merge_stats(root, group->merged_root);
+        const auto playouts = group->search.m_playouts.load();
+        m_playouts.add(playouts - group->merged_playouts);
+        group->merged_playouts = playouts;
+    }
+    m_root->refresh_child_stats();
+    m_root->update_proven(color);
+}
+
+// Called with the network drained, so every group is on its way out.
+void UCTSearch::finish_groups(int color) {
+    for (auto& group : m_groups) {
+        group->search.m_run = false;
+        group->workers.wait_all();
+    }
+    merge_groups(color);
+    for (auto& group : m_groups) {
+        group->search.m_last_rootstate =
+            std::make_unique<GameState>(group->rootstate);
+    }
 }
 
 float UCTSearch::get_min_psa_ratio() const {
-    const auto mem_full = UCTNodePointer::get_tree_size() / static_cast<float>(cfg_max_tree_size);
+    const auto mem_full = UCTNodePointer::get_tree_size() / static_cast<float>(get_max_tree_size());
     // If we are halfway through our memory budget, start trimming
     // moves with very low policy priors.
     if (mem_full > 0.5f) {
@@ -231,7 +480,54 @@ float UCTSearch::get_min_psa_ratio() const {
     return 0.0f;
 }
 
-SearchResult UCTSearch::play_simulation(GameState & currstate,
+std::size_t UCTSearch::select_child(UCTNode& position, int color) {
+    const auto is_root = &position == m_root.get();
+    if (is_root && m_halving.active()) {
+        return m_halving.select(position, &m_wait_stats);
+    }
+    if (is_root && !m_ponder_shares.empty()) {
+        return position.share_select_child(m_ponder_shares, &m_wait_stats);
+    }
+    return position.uct_select_child(color, is_root, &m_wait_stats);
+}
+
+UCTNode* UCTSearch::get_child(UCTNode& position, std::size_t index,
+                              const SearchState& state) {
+    const auto& child = position.get_children()[index];
+    if (m_transpositions && !child.is_inflated() && !child.is_linked()) {
+        child.link(m_transpositions->get_node(state.board.get_hash()));
+    }
+    return child.get();
+}
+
+// Only the subtree of the reply the opponent plays is kept, so pondering
+// goes to the cfg_ponder_replies most likely ones. Each gets the part of
+// the simulations it has of their visits so far, the prior breaking ties
+// between unvisited ones.
+void UCTSearch::set_ponder_shares() {
+    m_ponder_shares.clear();
+    auto candidates = std::vector<std::pair<float, std::size_t>>{};
+    const auto& children = m_root->get_children();
+    for (auto i = size_t{0}; i < children.size(); i++) {
+        const auto& child = children[i];
+        if (child.active() && !child.is_proven()) {
+            candidates.emplace_back(child.get_visits() + child.get_policy(), i);
+        }
+    }
+    const auto count = std::min(candidates.size(), size_t(cfg_ponder_replies));
+    std::partial_sort(begin(candidates), begin(candidates) + count,
+                      end(candidates), std::greater<>());
+    auto total = 0.0f;
+    for (auto i = size_t{0}; i < count; i++) {
+        total += candidates[i].first;
+    }
+    for (auto i = size_t{0}; i < count; i++) {
+        m_ponder_shares.emplace_back(candidates[i].second,
+                                     candidates[i].first / total);
+    }
+}
+
+SearchResult UCTSearch::play_simulation(SearchState & currstate,
                                         UCTNode* const node) {
     const auto color = currstate.get_to_move();
     auto result = SearchResult{};
@@ -244,10 +540,19 @@ SearchResult UCTSearch::play_simulation(GameState & currstate,
         node->virtual_loss_undo();
     } BOOST_SCOPE_EXIT_END
 
-    if (node->expandable()) {
+    auto descended = false;
+
+    if (node->is_proven()) {
+        // Decided already, nothing to learn further down.
+        if (!currstate.has_end()) {
+            m_threat_stats.hits++;
+        }
+        result = SearchResult::from_eval(node->get_proven_eval(FastBoard::BLACK));
+    } else if (node->expandable()) {
         if (currstate.has_end()) {
             auto score = currstate.final_score();
             result = SearchResult::from_score(score);
+            node->set_proven(result.eval());
         } else {
             float eval;
             const auto had_children = node->has_children();
@@ -256,7 +561,7 @@ SearchResult UCTSearch::play_simulation(GameState & currstate,
             // another thread requests draining the search.
             const auto success =
                 node->create_children(m_network, m_nodes, currstate, eval,
-                                      get_min_psa_ratio());
+                                      get_min_psa_ratio(), &m_threat_stats);
             if (!had_children && success) {
                 result = SearchResult::from_eval(eval);
                 new_node = true;
@@ -265,20 +570,275 @@ SearchResult UCTSearch::play_simulation(GameState & currstate,
     }
 
     if (node->has_children() && !result.valid()) {
-        auto next = node->uct_select_child(color, node == m_root.get());
-        auto move = next->get_move();
-        currstate.play_move(move);
+        const auto index = select_child(*node, color);
+        // Also takes back the virtual loss if something throws.
+        BOOST_SCOPE_EXIT(node, index, &result) {
+            node->update_child(index, result.valid(), result.eval());
+        } BOOST_SCOPE_EXIT_END
+        currstate.play_move(node->get_children()[index].get_move());
+        auto next = get_child(*node, index, currstate);
         result = play_simulation(currstate, next);
+        currstate.undo_move();
+        if (next->is_proven()) {
+            node->update_proven(color);
+        }
+        descended = true;
     }
 
-    // New node was updated in create_children.
-    if (result.valid() && !new_node) {
-        node->update(result.eval());
+    if (result.valid()) {
+        if (descended && m_transpositions) {
+            node->update_from_children();
+        } else if (!new_node) {
+            // New node was updated in create_children.
+            node->update(result.eval());
+        }
     }
 
     return result;
 }
 
+// play_simulation() without the recursion: walks down and stops where the
+// network is needed. That position is left EXPANDING for the caller.
+void UCTSearch::descend(SearchState& currstate, SimulationPath& path,
+                        float min_psa_ratio) {
+    path.min_psa_ratio = min_psa_ratio;
+    auto node = m_root.get();
+    while (true) {
+        const auto color = currstate.get_to_move();
+        node->virtual_loss();
+        path.steps.push_back({node, color, 0});
+
+        if (node->is_proven()) {
+            if (!currstate.has_end()) {
+                m_threat_stats.hits++;
+            }
+            path.result = SearchResult::from_eval(
+                node->get_proven_eval(FastBoard::BLACK));
+            return;
+        }
+        if (node->expandable()) {
+            if (currstate.has_end()) {
+                path.result = SearchResult::from_score(currstate.final_score());
+                node->set_proven(path.result.eval());
+                return;
+            }
+            float eval;
+            if (node->has_children()) {
+                // Widening a node that has children already is rare,
+                // don't bother batching it.
+                node->create_children(m_network, m_nodes, currstate, eval,
+                                      min_psa_ratio, &m_threat_stats);
+            } else {
+                const auto expansion = node->prepare_expansion(
+                    m_nodes, currstate, eval, min_psa_ratio, &m_threat_stats,
+                    path.reply);
+                if (expansion == UCTNode::Expansion::DONE) {
+                    path.result = SearchResult::from_eval(eval);
+                    path.new_node = true;
+                    return;
+                } else if (expansion == UCTNode::Expansion::NEEDS_EVAL) {
+                    path.leaf = node;
+                    path.state = std::make_unique<SearchState>(currstate);
+                    return;
+                }
+            }
+        }
+        // Without children here someone else is still expanding it.
+        if (!node->has_children()) {
+            return;
+        }
+
+        const auto index = select_child(*node, color);
+        path.steps.back().index = index;
+        currstate.play_move(node->get_children()[index].get_move());
+        node = get_child(*node, index, currstate);
+    }
+}
+
+// The bookkeeping play_simulation() does on its way back up, for every
+// step of the path.
+void UCTSearch::backup(SimulationPath& path) {
+    assert(!path.backed_up);
+    const auto& result = path.result;
+    for (auto i = path.steps.size(); i-- > 0;) {
+        const auto& step = path.steps[i];
+        const auto descended = i + 1 < path.steps.size();
+        if (descended) {
+            if (path.steps[i + 1].node->is_proven()) {
+                step.node->update_proven(step.color);
+            }
+            step.node->update_child(step.index, result.valid(), result.eval());
+        }
+        if (result.valid()) {
+            // A new node was updated when it was expanded.
+            const auto updated = path.new_node && !descended;
+            if (descended && m_transpositions) {
+                step.node->update_from_children();
+            } else if (!updated) {
+                step.node->update(result.eval());
+            }
+        }
+        step.node->virtual_loss_undo();
+    }
+    path.backed_up = true;
+}
+
+int UCTSearch::play_simulation_batch(SearchState& currstate) {
+    const auto min_psa_ratio = get_min_psa_ratio();
+    auto paths = std::vector<SimulationPath>(cfg_leaf_batch);
+    auto leaves = std::vector<SimulationPath*>{};
+    auto finished = 0;
+    try {
+        for (auto& path : paths) {
+            currstate.rewind();
+            descend(currstate, path, min_psa_ratio);
+            if (path.leaf) {
+                leaves.emplace_back(&path);
+                continue;
+            }
+            // Known results go back up right away. Without a result we ran
+            // into a leaf that is being evaluated, by this batch or another
+            // thread. The virtual loss keeps the next descents away from it.
+            if (path.result.valid()) {
+                finished++;
+            } else {
+                m_batch_stats.collisions++;
+            }
+            backup(path);
+        }
+        if (leaves.empty()) {
+            return finished;
+        }
+
+        auto states = std::vector<const SearchState*>{};
+        for (auto path : leaves) {
+            if (path->reply != FastBoard::NO_VERTEX) {
+                path->state->play_move(path->reply);
+            }
+            states.emplace_back(path->state.get());
+        }
+        const auto results = m_network.get_output_batch(states);
+        m_batch_stats.batches++;
+        m_batch_stats.leaves += leaves.size();
+
+        for (auto i = size_t{0}; i < leaves.size(); i++) {
+            auto& path = *leaves[i];
+            const auto eval_reply = path.reply != FastBoard::NO_VERTEX;
+            if (eval_reply) {
+                path.state->undo_move();
+            }
+            float eval;
+            path.leaf->finish_expansion(m_nodes, *path.state, results[i],
+                                        eval_reply, eval, min_psa_ratio);
+            path.leaf = nullptr;
+            path.result = SearchResult::from_eval(eval);
+            path.new_node = true;
+            backup(path);
+            finished++;
+        }
+    } catch (NetworkHaltException&) {
+        // Give back the locks and virtual losses, without any result.
+        for (auto& path : paths) {
+            if (path.backed_up || path.steps.empty()) {
+                continue;
+            }
+            if (path.leaf) {
+                path.leaf->cancel_expansion();
+            }
+            path.result = SearchResult{};
+            backup(path);
+        }
+        throw;
+    }
+    return finished;
+}
+
+void UCTSearch::resume(SimulationPath& path,
+                       const AsyncEvaluator::Completion& completion) {
+    const auto eval_reply = path.reply != FastBoard::NO_VERTEX;
+    if (eval_reply) {
+        path.state->undo_move();
+    }
+    if (completion.halted) {
+        path.leaf->cancel_expansion();
+    } else {
+        float eval;
+        path.leaf->finish_expansion(m_nodes, *path.state, completion.result,
+                                    eval_reply, eval, path.min_psa_ratio);
+        path.result = SearchResult::from_eval(eval);
+        path.new_node = true;
+        increment_playouts();
+    }
+    path.leaf = nullptr;
+    backup(path);
+}
+
+void UCTSearch::play_simulations_async(SearchState& currstate) {
+    assert(m_evaluator);
+    AsyncEvaluator::CompletionQueue completions;
+    auto in_flight = 0;
+    auto halted = false;
+    auto skip_limits = 0;
+    // The evaluator hands back the path we gave it as the tag.
+    const auto resume_next = [&](AsyncEvaluator::Completion&& completion) {
+        auto path = std::unique_ptr<SimulationPath>(
+            static_cast<SimulationPath*>(completion.tag));
+        halted |= completion.halted;
+        resume(*path, completion);
+        in_flight--;
+    };
+
+    for (;;) {
+        auto completion = AsyncEvaluator::Completion{};
+        while (completions.try_pop(completion)) {
+            resume_next(std::move(completion));
+        }
+        const auto running = is_running(skip_limits) && !halted;
+        if (!running && in_flight == 0) {
+            return;
+        }
+        if (!running || in_flight >= cfg_async_sims) {
+            m_evaluator->flush();
+            resume_next(completions.pop());
+            continue;
+        }
+
+        auto path = std::make_unique<SimulationPath>();
+        currstate.rewind();
+        try {
+            descend(currstate, *path, get_min_psa_ratio());
+        } catch (NetworkHaltException&) {
+            // Widening a node evaluates right away, and that can be halted.
+            path->result = SearchResult{};
+            backup(*path);
+            halted = true;
+            continue;
+        }
+        if (path->leaf) {
+            if (path->reply != FastBoard::NO_VERTEX) {
+                path->state->play_move(path->reply);
+            }
+            const auto state = path->state.get();
+            m_evaluator->submit(state, path.release(), completions);
+            in_flight++;
+            continue;
+        }
+
+        if (path->result.valid()) {
+            increment_playouts();
+        } else {
+            m_batch_stats.collisions++;
+        }
+        backup(*path);
+        // Rather than running into the same leaf again, wait for an eval
+        // to come back.
+        if (!path->result.valid() && in_flight > 0) {
+            m_evaluator->flush();
+            resume_next(completions.pop());
+        }
+    }
+}
+
 void UCTSearch::dump_stats(FastState & state, UCTNode & parent) {
     if (cfg_quiet || !parent.has_children()) {
         return;
@@ -317,7 +877,13 @@ void UCTSearch::dump_stats(FastState & state, UCTNode & parent) {
             node->get_policy() * 100.0f,
             pv.c_str());
     }
-    tree_stats(parent);
+    if (m_transpositions) {
+        // Shared subtrees would be walked once for every way to reach them.
+        myprintf("%zu positions in the transposition table\n",
+                 m_transpositions->size());
+    } else {
+        tree_stats(parent);
+    }
 }
 
 void UCTSearch::output_analysis(FastState & state, UCTNode & parent) {
@@ -480,7 +1046,12 @@ int UCTSearch::get_best_move(passflag_t passflag) {
     // to the playout counts, early game only.
     // 最开始30步加大随机性 鼓励探索
     auto movenum = int(m_rootstate.get_movenum());
-    if (movenum < cfg_random_cnt) {
+    const auto proven_win = m_root->get_first_child()->is_proven()
+        && m_root->get_first_child()->get_proven_eval(color) > 0.5f;
+    if (m_halving.active() && !proven_win) {
+        // The Gumbel noise already randomized it.
+        m_root->set_first_child(m_halving.get_best_move(*m_root));
+    } else if (movenum < cfg_random_cnt) {
         m_root->randomize_first_proportionally();
     }
 
@@ -639,7 +1210,34 @@ std::string UCTSearch::get_analysis(int playouts) {
 }
 
 bool UCTSearch::is_running() const {
-    return m_run && UCTNodePointer::get_tree_size() < cfg_max_tree_size;
+    // Nothing left to search once the root is proven. Visits to proven
+    // nodes are nearly free, so the workers check the limits themselves
+    // instead of overshooting them until think() looks again.
+    return m_run && UCTNodePointer::get_tree_size() < get_max_tree_size()
+           && !limits_reached();
+}
+
+bool UCTSearch::is_running(int& skip_limits) const {
+    if (!m_run || UCTNodePointer::get_tree_size() >= get_max_tree_size()
+        || m_root->is_proven()) {
+        return false;
+    }
+    // The playouts and root visits are added up over all stripes. Look
+    // again only once the threads together could have used up half of
+    // what was left, so they never overshoot.
+    if (skip_limits-- > 0) {
+        return true;
+    }
+    const auto left = std::min(m_maxplayouts - m_playouts.load(),
+                               m_maxvisits - m_root->get_visits());
+    skip_limits = left / (2 * std::max(1, int(cfg_num_threads)));
+    return left > 0;
+}
+
+bool UCTSearch::limits_reached() const {
+    return m_root->is_proven()
+           || m_playouts.load() >= m_maxplayouts
+           || m_root->get_visits() >= m_maxvisits;
 }
 
 int UCTSearch::est_playouts_left(int elapsed_centis, int time_for_move) const {
@@ -696,6 +1294,9 @@ size_t UCTSearch::prune_noncontenders(int color, int elapsed_centis, int time_fo
             }
         }
     }
+    if (prune) {
+        m_root->refresh_child_stats();
+    }
     ///myprintf("pruned nodes: ...\n", pruned_nodes);
     ///myprintf("size: ", m_root->get_children().size());
     assert(pruned_nodes < m_root->get_children().size());
@@ -737,33 +1338,70 @@ bool UCTSearch::have_alternate_moves(int elapsed_centis, int time_for_move) {
 }
 
 bool UCTSearch::stop_thinking(int elapsed_centis, int time_for_move) const {
-    return m_playouts >= m_maxplayouts
+    return m_playouts.load() >= m_maxplayouts
            || m_root->get_visits() >= m_maxvisits
            || elapsed_centis >= time_for_move;
 }
 
+UCTWorker::UCTWorker(GameState & state, UCTSearch * search, UCTNode * root)
+    : m_rootstate(state), m_search(search), m_root(root),
+      m_analyze_tags(&cfg_analyze_tags) {}
+
 void UCTWorker::operator()() {
+    cfg_analyze_tags = *m_analyze_tags;
     try {
+        auto currstate = SearchState(m_rootstate);
+        auto skip_limits = 0;
+        if (cfg_async_sims > 0) {
+            m_search->play_simulations_async(currstate);
+            return;
+        }
         do {
-            auto currstate = std::make_unique<GameState>(m_rootstate);
-            auto result = m_search->play_simulation(*currstate, m_root);
+            if (cfg_leaf_batch > 1) {
+                const auto finished = m_search->play_simulation_batch(currstate);
+                for (auto i = 0; i < finished; i++) {
+                    m_search->increment_playouts();
+                }
+                continue;
+            }
+            currstate.rewind();
+            auto result = m_search->play_simulation(currstate, m_root);
             if (result.valid()) {
                 m_search->increment_playouts();
             }
-        } while (m_search->is_running());
+        } while (m_search->is_running(skip_limits));
     } catch (NetworkHaltException&) {
         // intentionally empty
     }
 }
 
 void UCTSearch::increment_playouts() {
-    m_playouts++;
+    m_playouts.add(1);
 }
 
 int UCTSearch::think(int color, passflag_t passflag) {
     // Start counting time for us
     m_rootstate.start_clock(color);
 
+    // Play straight from the opening book while it knows the position.
+    if (GTP::s_book && m_rootstate.get_movenum() < size_t(cfg_book_depth)
+        && !cfg_analyze_tags.has_move_restrictions()) {
+        m_rootstate.board.set_to_move(color);
+        const auto bookmove =
+            GTP::s_book->probe(m_rootstate, cfg_book_min_visits);
+        if (bookmove != FastBoard::NO_VERTEX) {
+            m_rootstate.stop_clock(color);
+            myprintf("Book move: %s\n",
+                     m_rootstate.move_to_text(bookmove).c_str());
+            m_think_output =
+                str(boost::format("move %d, %c => %s (book)\n")
+                % m_rootstate.get_movenum()
+                % (color == FastBoard::BLACK ? 'B' : 'W')
+                % m_rootstate.move_to_text(bookmove).c_str());
+            return bookmove;
+        }
+    }
+
     // set up timing info
     Time start;
 
@@ -780,11 +1418,24 @@ int UCTSearch::think(int color, passflag_t passflag) {
 
     // create a sorted list of legal moves (make sure we
     // play something legal and decent even in time trouble)
-    m_root->prepare_root_node(m_network, color, m_nodes, m_rootstate);
+    m_root->prepare_root_node(m_network, color, m_nodes, m_rootstate,
+                              cfg_noise && !m_fast_search);
     myprintf("root node size: %d\n", m_root->get_children().size());
 
+    if (cfg_gumbel && !m_fast_search) {
+        // Sequential halving splits a known number of visits.
+        const auto budget = std::min(m_maxplayouts,
+                                     m_maxvisits - m_root->get_visits());
+        if (budget < UNLIMITED_PLAYOUTS) {
+            m_halving.start(*m_root, color, budget);
+        } else {
+            myprintf("Gumbel search needs a visit or playout limit.\n");
+        }
+    }
+
     m_run = true;
-    int cpus = cfg_num_threads;
+    start_groups(color);
+    int cpus = get_group_threads(0);
     ThreadGroup tg(thread_pool);
     for (int i = 0; i < cpus; i++) {
         tg.add_task(UCTWorker(m_rootstate, this, m_root.get()));
@@ -795,6 +1446,7 @@ int UCTSearch::think(int color, passflag_t passflag) {
     auto last_output = 0;
     do {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        merge_groups(color);
 
         Time elapsed;
         int elapsed_centis = Time::timediff_centis(start, elapsed);
@@ -811,9 +1463,12 @@ int UCTSearch::think(int color, passflag_t passflag) {
             last_update = elapsed_centis;
             myprintf("%s\n", get_analysis(m_playouts.load()).c_str());
         }
-        keeprunning  = is_running();
+        keeprunning  = is_running() || recycle_tree(tg);
         keeprunning &= !stop_thinking(elapsed_centis, time_for_move);
-        keeprunning &= have_alternate_moves(elapsed_centis, time_for_move);
+        // Halving has to see its phases through.
+        if (!m_halving.active()) {
+            keeprunning &= have_alternate_moves(elapsed_centis, time_for_move);
+        }
     } while (keeprunning);
 
     // Make sure to post at least once.
@@ -823,14 +1478,20 @@ int UCTSearch::think(int color, passflag_t passflag) {
 
     // Stop the search.
     m_run = false;
-    m_network.drain_evals();
+    if (!shares_network()) {
+        m_network.drain_evals();
+    }
     tg.wait_all();
-    m_network.resume_evals();
+    finish_groups(color);
+    if (!shares_network()) {
+        m_network.resume_evals();
+    }
 
     // Reactivate all pruned root children.
     for (const auto& node : m_root->get_children()) {
         node->set_active(true);
     }
+    m_root->refresh_child_stats();
 
     m_rootstate.stop_clock(color);
     if (!m_root->has_children()) {
@@ -840,7 +1501,17 @@ int UCTSearch::think(int color, passflag_t passflag) {
     // Display search info.
     myprintf("\n");
     dump_stats(m_rootstate, *m_root);
-    Training::record(m_network, m_rootstate, *m_root);
+    if (m_halving.active()) {
+        Training::record(m_network, m_rootstate, *m_root,
+                         m_halving.get_improved_policy(*m_root));
+    } else {
+        Training::record(m_network, m_rootstate, *m_root, {}, !m_fast_search);
+    }
+    if (m_root->is_proven()) {
+        const auto eval = m_root->get_proven_eval(color);
+        myprintf("Position proven: %s.\n",
+                 eval > 0.5f ? "win" : (eval < 0.5f ? "loss" : "draw"));
+    }
 
     Time elapsed;
     int elapsed_centis = Time::timediff_centis(start, elapsed);
@@ -848,7 +1519,33 @@ int UCTSearch::think(int color, passflag_t passflag) {
              m_root->get_visits(),
              m_nodes.load(),
              m_playouts.load(),
-             (m_playouts * 100.0) / (elapsed_centis+1));
+             (m_playouts.load() * 100.0) / (elapsed_centis+1));
+    if (m_threat_stats.tries > 0) {
+        myprintf("threat search: %d won, %d lost of %d tried, %lld nodes, "
+                 "%d NN evals saved\n\n",
+                 m_threat_stats.wins.load(),
+                 m_threat_stats.losses.load(),
+                 m_threat_stats.tries.load(),
+                 static_cast<long long>(m_threat_stats.nodes.load()),
+                 m_threat_stats.saved_evals());
+    }
+    if (m_batch_stats.batches > 0) {
+        myprintf("leaf batches: %d leaves in %d batches, %d collisions\n\n",
+                 m_batch_stats.leaves.load(),
+                 m_batch_stats.batches.load(),
+                 m_batch_stats.collisions.load());
+    }
+    if (m_recycle_stats.passes > 0) {
+        myprintf("tree recycled %d times, %.1f MiB reclaimed\n\n",
+                 m_recycle_stats.passes,
+                 m_recycle_stats.bytes / (1024.0 * 1024.0));
+    }
+    if (m_wait_stats.waits > 0) {
+        myprintf("expansion waits: %d, %d slept, %.1f ms total\n\n",
+                 m_wait_stats.waits.load(),
+                 m_wait_stats.parks.load(),
+                 m_wait_stats.wait_us.load() / 1000.0);
+    }
 
 #ifdef USE_OPENCL
 #ifndef NDEBUG
@@ -879,6 +1576,32 @@ std::string UCTSearch::explain_last_think() const {
     return m_think_output;
 }
 
+bool UCTSearch::save_tree(const std::string& filename) const {
+    // With transpositions the tree is a graph, shared nodes would be
+    // written once for every parent.
+    if (m_transpositions || !m_last_rootstate) {
+        return false;
+    }
+    return TreeFile::save(filename, *m_root, *m_last_rootstate);
+}
+
+bool UCTSearch::load_tree(const std::string& filename) {
+    if (cfg_transpositions) {
+        return false;
+    }
+    auto rootstate = std::unique_ptr<GameState>{};
+    auto root = TreeFile::load(filename, m_rootstate, rootstate);
+    if (!root) {
+        return false;
+    }
+    delete_tree(std::move(m_root));
+    m_root = std::move(root);
+    m_nodes = m_root->count_nodes_and_clear_expand_state();
+    // The next search reuses it like the tree of its own last move.
+    m_last_rootstate = std::move(rootstate);
+    return true;
+}
+
 void UCTSearch::ponder() {
     auto disable_reuse = cfg_analyze_tags.has_move_restrictions();
     if (disable_reuse) {
@@ -888,7 +1611,12 @@ void UCTSearch::ponder() {
     update_root();
 
     m_root->prepare_root_node(m_network, m_rootstate.board.get_to_move(),
-                              m_nodes, m_rootstate);
+                              m_nodes, m_rootstate, cfg_noise);
+    // Analysis wants the search of the root as it is.
+    if (cfg_ponder_replies > 0 && !disable_reuse
+        && !cfg_analyze_tags.interval_centis()) {
+        set_ponder_shares();
+    }
 
     m_run = true;
     ThreadGroup tg(thread_pool);
@@ -908,7 +1636,7 @@ void UCTSearch::ponder() {
                 output_analysis(m_rootstate, *m_root);
             }
         }
-        keeprunning  = is_running();
+        keeprunning  = is_running() || recycle_tree(tg);
         keeprunning &= !stop_thinking(0, 1);
     } while (!Utils::input_pending() && keeprunning);
 
@@ -919,9 +1647,22 @@ void UCTSearch::ponder() {
 
     // Stop the search.
     m_run = false;
-    m_network.drain_evals();
+    if (!shares_network()) {
+        m_network.drain_evals();
+    }
     tg.wait_all();
-    m_network.resume_evals();
+    if (!shares_network()) {
+        m_network.resume_evals();
+    }
+
+    for (const auto& share : m_ponder_shares) {
+        const auto& child = m_root->get_children()[share.first];
+        myprintf("ponder %4s: %7d visits, %4.1f%% of the replies pondered\n",
+                 m_rootstate.move_to_text(child.get_move()).c_str(),
+                 child.get_visits(), 100.0f * share.second);
+    }
+    // dump_stats() sorts the children.
+    m_ponder_shares.clear();
 
     // Display search info.
     myprintf("\n");
@@ -950,3 +1691,132 @@ void UCTSearch::set_visit_limit(int visits) {
     m_maxvisits = std::min(visits, UNLIMITED_PLAYOUTS);
 }
 
+bool UCTSearch::shares_network() const {
+    // Draining would halt the evals of the other games, m_run stops
+    // our workers after their simulation instead.
+    return m_shared_evaluator || !cfg_server.empty();
+}
+
+void UCTSearch::set_tree_searches(int searches) {
+    m_tree_searches = std::max(1, searches);
+}
+
+size_t UCTSearch::get_max_tree_size() const {
+    return cfg_max_tree_size * m_tree_searches;
+}
+
+void UCTSearch::set_fast_search(bool fast) {
+    m_fast_search = fast;
+    set_visit_limit(fast ? cfg_fast_visits : cfg_max_visits);
+}
+
+// Random openings with a fixed seed, the same for every run.
+static std::vector<GameState> benchmark_positions(int positions) {
+    Random rng(5489);
+    auto states = std::vector<GameState>{};
+    for (auto p = 0; p < positions; p++) {
+        GameState state;
+        state.init_game(BOARD_SIZE);
+        state.set_timecontrol(0, 1, 0, 0);  // Set infinite time.
+        const auto moves = 2 + p % 4;
+        for (auto m = 0; m < moves && !state.has_end(); m++) {
+            const auto color = state.get_to_move();
+            auto legal = std::vector<int>{};
+            for (auto i = 0; i < NUM_INTERSECTIONS; i++) {
+                if (state.get_legal_mask(color)[i]) {
+                    legal.emplace_back(state.board.get_vertex(i % BOARD_SIZE,
+                                                              i / BOARD_SIZE));
+                }
+            }
+            state.play_move(legal[rng.randuint64(legal.size())]);
+        }
+        states.emplace_back(state);
+    }
+    return states;
+}
+
+void UCTSearch::group_benchmark(Network& network, int playouts, int positions) {
+    const auto states = benchmark_positions(positions);
+
+    const auto saved_groups = cfg_root_groups;
+    const auto saved_quiet = cfg_quiet;
+    const auto saved_noise = cfg_noise;
+    const auto saved_random = cfg_random_cnt;
+    cfg_noise = false;
+    cfg_random_cnt = 0;
+
+    auto reference = std::vector<int>{};
+    for (auto groups = size_t{1}; ; groups *= 2) {
+        groups = std::min(groups, size_t(cfg_num_threads));
+        cfg_root_groups = groups;
+        cfg_quiet = true;
+        auto total_playouts = 0;
+        auto agree = 0;
+        const Time start;
+        for (auto p = size_t{0}; p < states.size(); p++) {
+            auto state = states[p];
+            auto search = std::make_unique<UCTSearch>(state, network);
+            search->set_playout_limit(playouts);
+            search->set_visit_limit(UNLIMITED_PLAYOUTS);
+            const auto move = search->think(state.get_to_move(), NORESIGN);
+            total_playouts += search->m_playouts.load();
+            if (groups == 1) {
+                reference.emplace_back(move);
+            }
+            agree += (move == reference[p]);
+        }
+        const Time end;
+        cfg_quiet = saved_quiet;
+        const auto seconds = Time::timediff_seconds(start, end);
+        myprintf("%2zu groups: %8.0f playouts/s, best move agrees %d/%d\n",
+                 groups, total_playouts / std::max(seconds, 1e-9),
+                 agree, int(states.size()));
+        if (groups == cfg_num_threads) {
+            break;
+        }
+    }
+
+    cfg_root_groups = saved_groups;
+    cfg_noise = saved_noise;
+    cfg_random_cnt = saved_random;
+}
+
+void UCTSearch::striping_benchmark(Network& network, int playouts,
+                                   int positions) {
+    const auto states = benchmark_positions(positions);
+
+    const auto saved_striping = cfg_striping;
+    const auto saved_quiet = cfg_quiet;
+    const auto saved_noise = cfg_noise;
+    const auto saved_random = cfg_random_cnt;
+    cfg_noise = false;
+    cfg_random_cnt = 0;
+
+    for (const auto striping : {false, true}) {
+        cfg_striping = striping;
+        cfg_quiet = true;
+        // Neither run gets the other's evals for free.
+        network.nncache_clear();
+        auto total_playouts = 0;
+        const Time start;
+        for (const auto& position : states) {
+            auto state = position;
+            auto search = std::make_unique<UCTSearch>(state, network);
+            search->set_playout_limit(playouts);
+            search->set_visit_limit(UNLIMITED_PLAYOUTS);
+            search->think(state.get_to_move(), NORESIGN);
+            total_playouts += search->m_playouts.load();
+        }
+        const Time end;
+        cfg_quiet = saved_quiet;
+        const auto seconds = Time::timediff_seconds(start, end);
+        myprintf("%s: %8.0f playouts/s with %u threads\n",
+                 striping ? "striped" : "shared ",
+                 total_playouts / std::max(seconds, 1e-9), cfg_num_threads);
+    }
+
+    cfg_striping = saved_striping;
+    cfg_noise = saved_noise;
+    cfg_random_cnt = saved_random;
+}
+
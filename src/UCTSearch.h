@@ -36,15 +36,23 @@
 #include <string>
 #include <tuple>
 #include <future>
+#include <vector>
 
 #include "ThreadPool.h"
+#include "AsyncEvaluator.h"
 #include "FastBoard.h"
 #include "FastState.h"
 #include "GameState.h"
+#include "SearchState.h"
+#include "SequentialHalving.h"
+#include "StripedStats.h"
+#include "TranspositionTable.h"
 #include "UCTNode.h"
 #include "Network.h"
 
 
+class AnalyzeTags;
+
 class SearchResult {
 public:
     SearchResult() = default;
@@ -69,6 +77,16 @@ private:
     float m_eval{0.0f};
 };
 
+struct RecycleStats {
+    int passes{0};
+    size_t bytes{0};
+
+    void clear() {
+        passes = 0;
+        bytes = 0;
+    }
+};
+
 namespace TimeManagement {
     enum enabled_t {
         AUTO = -1, OFF = 0, ON = 1, FAST = 2, NO_PRUNING = 3
@@ -99,6 +117,11 @@ public:
     */
     static constexpr size_t MIN_TREE_SPACE = 100'000'000;
 
+    /*
+        Part of the tree budget left in use after recycling.
+    */
+    static constexpr float RECYCLE_TARGET = 0.75f;
+
     /*
         Value representing unlimited visits or playouts. Due to
         concurrent updates while multithreading, we need some
@@ -107,18 +130,78 @@ public:
     static constexpr auto UNLIMITED_PLAYOUTS =
         std::numeric_limits<int>::max() / 2;
 
-    UCTSearch(GameState& g, Network & network);
+    // With an evaluator, the async simulations share it with other searches
+    // instead of starting their own.
+    UCTSearch(GameState& g, Network & network,
+              std::shared_ptr<AsyncEvaluator> evaluator = nullptr);
+    ~UCTSearch();
     int think(int color, passflag_t passflag = NORMAL);
     void set_playout_limit(int playouts);
     void set_visit_limit(int visits);
+    // The tree size is counted over every tree in the process. With
+    // several searches, each of them should get cfg_max_tree_size.
+    void set_tree_searches(int searches);
+    // A fast search plays with cfg_fast_visits, no noise and no policy
+    // target, see selfplay().
+    void set_fast_search(bool fast);
     void ponder();
     bool is_running() const;
+    // For the workers, skip_limits is theirs to keep between calls.
+    bool is_running(int& skip_limits) const;
     void increment_playouts();
     std::string explain_last_think() const;
-    SearchResult play_simulation(GameState& currstate, UCTNode* const node);
+    // The tree of the last search, to continue it after a restart.
+    bool save_tree(const std::string& filename) const;
+    bool load_tree(const std::string& filename);
+    // Playouts per second and best move agreement for 1, 2, 4... root
+    // groups, up to one per thread.
+    static void group_benchmark(Network& network, int playouts, int positions);
+    // Playouts per second of whole searches with and without striping.
+    static void striping_benchmark(Network& network, int playouts,
+                                   int positions);
+    SearchResult play_simulation(SearchState& currstate, UCTNode* const node);
+    // Descends cfg_leaf_batch times under virtual loss, evaluates the new
+    // leaves as one network batch and backs them all up. Returns the number
+    // of simulations that produced a result.
+    int play_simulation_batch(SearchState& currstate);
+    // Keeps up to cfg_async_sims simulations waiting on the evaluator and
+    // descends further while they do, until the search stops.
+    void play_simulations_async(SearchState& currstate);
 
 private:
+    // One descent of play_simulation_batch(), root first.
+    struct SimulationPath {
+        struct Step {
+            UCTNode* node;
+            int color;
+            // Child selected from node, if we went further down.
+            std::size_t index;
+        };
+        std::vector<Step> steps;
+        SearchResult result;
+        bool new_node{false};
+        bool backed_up{false};
+        // Set if the last position waits for its network eval, which is
+        // done after playing reply unless that is NO_VERTEX.
+        UCTNode* leaf{nullptr};
+        int reply{FastBoard::NO_VERTEX};
+        float min_psa_ratio{0.0f};
+        std::unique_ptr<SearchState> state;
+    };
+    void resume(SimulationPath& path, const AsyncEvaluator::Completion& completion);
+    void descend(SearchState& currstate, SimulationPath& path,
+                 float min_psa_ratio);
+    void backup(SimulationPath& path);
+
     float get_min_psa_ratio() const;
+    // uct_select_child(), or at the root the move of a Gumbel search or,
+    // while pondering on a few replies, the one that is furthest behind.
+    std::size_t select_child(UCTNode& position, int color);
+    // The node of that child, where state is after its move. With
+    // transpositions it is linked to the shared node of the position.
+    UCTNode* get_child(UCTNode& position, std::size_t index,
+                       const SearchState& state);
+    void set_ponder_shares();
     void dump_stats(FastState& state, UCTNode& parent);
     void tree_stats(const UCTNode& node);
     std::string get_pv(FastState& state, UCTNode& parent);
@@ -129,19 +212,45 @@ private:
     size_t prune_noncontenders(int color, int elapsed_centis = 0, int time_for_move = 0,
                                bool prune = true);
     bool stop_thinking(int elapsed_centis = 0, int time_for_move = 0) const;
+    bool limits_reached() const;
+    size_t get_max_tree_size() const;
     int get_best_move(passflag_t passflag);
     void update_root();
+    bool recycle_tree(Utils::ThreadGroup& workers);
+    void start_groups(int color);
+    void merge_groups(int color);
+    void finish_groups(int color);
+    void delete_tree(std::unique_ptr<UCTNode> root);
     bool advance_to_new_rootstate();
     void output_analysis(FastState & state, UCTNode & parent);
 
     GameState & m_rootstate;
     std::unique_ptr<GameState> m_last_rootstate;
     std::unique_ptr<UCTNode> m_root;
+    std::unique_ptr<TranspositionTable> m_transpositions;
+    std::shared_ptr<AsyncEvaluator> m_evaluator;
+    // Other searches use the network then, it can't be drained.
+    bool m_shared_evaluator{false};
+    bool shares_network() const;
+    // With --rootgroups, the other trees searching the same position on
+    // their own threads. What they find at the root is added to ours.
+    struct SearchGroup;
+    std::vector<std::unique_ptr<SearchGroup>> m_groups;
+    // (index, share) of the root children pondering is spread over.
+    std::vector<std::pair<std::size_t, float>> m_ponder_shares;
+    // Root moves of a search with cfg_gumbel.
+    SequentialHalving m_halving;
+    bool m_fast_search{false};
     std::atomic<int> m_nodes{0};
-    std::atomic<int> m_playouts{0};
+    StripedCounter m_playouts;
+    ThreatStats m_threat_stats;
+    LeafBatchStats m_batch_stats;
+    RecycleStats m_recycle_stats;
+    ExpandWaitStats m_wait_stats;
     std::atomic<bool> m_run{false};
     int m_maxplayouts;
     int m_maxvisits;
+    int m_tree_searches;
     std::string m_think_output;
 
     std::list<Utils::ThreadGroup> m_delete_futures;
@@ -151,13 +260,14 @@ private:
 
 class UCTWorker {
 public:
-    UCTWorker(GameState & state, UCTSearch * search, UCTNode * root)
-      : m_rootstate(state), m_search(search), m_root(root) {}
+    UCTWorker(GameState & state, UCTSearch * search, UCTNode * root);
     void operator()();
 private:
     GameState & m_rootstate;
     UCTSearch * m_search;
     UCTNode * m_root;
+    // cfg_analyze_tags of the thread that started the search.
+    const AnalyzeTags * m_analyze_tags;
 };
 
 #endif
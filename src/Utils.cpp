@@ -50,6 +50,9 @@
 
 Utils::ThreadPool thread_pool;
 
+static thread_local FILE* s_gtp_out = nullptr;
+static thread_local int s_gtp_input_fd = 0;
+
 auto constexpr z_entries = 1000;
 std::array<float, z_entries> z_lookup;
 
@@ -78,10 +81,10 @@ bool Utils::input_pending() {
 #ifdef HAVE_SELECT
     fd_set read_fds;
     FD_ZERO(&read_fds);
-    FD_SET(0,&read_fds);
+    FD_SET(s_gtp_input_fd,&read_fds);
     struct timeval timeout{0,0};
-    select(1,&read_fds,nullptr,nullptr,&timeout);
-    return FD_ISSET(0, &read_fds);
+    select(s_gtp_input_fd + 1,&read_fds,nullptr,nullptr,&timeout);
+    return FD_ISSET(s_gtp_input_fd, &read_fds);
 #else
     static int init = 0, pipe;
     static HANDLE inh;
@@ -161,7 +164,9 @@ static void gtp_base_printf(int id, std::string prefix,
     if (id != -1) {
         prefix += std::to_string(id);
     }
-    gtp_fprintf(stdout, prefix, fmt, ap);
+    const auto out = s_gtp_out ? s_gtp_out : stdout;
+    gtp_fprintf(out, prefix, fmt, ap);
+    fflush(out);
     if (cfg_logfile_handle) {
         std::lock_guard<std::mutex> lock(IOmutex);
         gtp_fprintf(cfg_logfile_handle, prefix, fmt, ap);
@@ -178,7 +183,9 @@ void Utils::gtp_printf(int id, const char *fmt, ...) {
 void Utils::gtp_printf_raw(const char *fmt, ...) {
     va_list ap;
     va_start(ap, fmt);
-    vfprintf(stdout, fmt, ap);
+    const auto out = s_gtp_out ? s_gtp_out : stdout;
+    vfprintf(out, fmt, ap);
+    fflush(out);
     va_end(ap);
 
     if (cfg_logfile_handle) {
@@ -196,6 +203,11 @@ void Utils::gtp_fail_printf(int id, const char *fmt, ...) {
     va_end(ap);
 }
 
+void Utils::set_gtp_streams(FILE* out, int input_fd) {
+    s_gtp_out = out;
+    s_gtp_input_fd = input_fd;
+}
+
 void Utils::log_input(const std::string& input) {
     if (cfg_logfile_handle) {
         std::lock_guard<std::mutex> lock(IOmutex);
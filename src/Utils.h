@@ -33,6 +33,7 @@
 #include "config.h"
 
 #include <atomic>
+#include <cstdio>
 #include <limits>
 #include <string>
 
@@ -48,6 +49,9 @@ namespace Utils {
     void gtp_fail_printf(int id, const char *fmt, ...);
     void log_input(const std::string& input);
     bool input_pending();
+    // GTP output and input_pending() of this thread go to out and
+    // input_fd instead of stdout and stdin, see GTPServer.
+    void set_gtp_streams(FILE* out, int input_fd);
 
     template<class T>
     void atomic_add(std::atomic<T> &f, T d) {
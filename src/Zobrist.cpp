@@ -29,10 +29,13 @@
 
 #include "config.h"
 #include "Zobrist.h"
+#include "Network.h"
 #include "Random.h"
 
 std::array<std::array<std::uint64_t, FastBoard::NUM_VERTICES>,     4> Zobrist::zobrist;
 std::array<std::uint64_t, FastBoard::NUM_VERTICES>                    Zobrist::zobrist_ko;
+std::array<std::array<std::array<std::uint64_t, FastBoard::NUM_VERTICES>, 4>,
+           FullBoard::NUM_SYMMETRIES>                                 Zobrist::zobrist_symmetry;
 //std::array<std::array<std::uint64_t, FastBoard::NUM_VERTICES * 2>, 2> Zobrist::zobrist_pris;
 //std::array<std::uint64_t, 5>                                          Zobrist::zobrist_pass;
 
@@ -47,6 +50,23 @@ void Zobrist::init_zobrist(Random& rng) {
         Zobrist::zobrist_ko[j] = rng.randuint64();
     }
 
+    constexpr auto sidevertices = BOARD_SIZE + 2;
+    for (int sym = 0; sym < FullBoard::NUM_SYMMETRIES; sym++) {
+        for (int i = 0; i < 4; i++) {
+            /// 棋盘外的点不参与变换
+            Zobrist::zobrist_symmetry[sym][i] = Zobrist::zobrist[i];
+            for (int y = 0; y < BOARD_SIZE; y++) {
+                for (int x = 0; x < BOARD_SIZE; x++) {
+                    const auto vertex = (y + 1) * sidevertices + (x + 1);
+                    const auto newvtx = Network::get_symmetry({x, y}, sym);
+                    Zobrist::zobrist_symmetry[sym][i][vertex] =
+                        Zobrist::zobrist[i][(newvtx.second + 1) * sidevertices
+                                            + (newvtx.first + 1)];
+                }
+            }
+        }
+    }
+
 //    for (int i = 0; i < 2; i++) {
 //        for (int j = 0; j < FastBoard::NUM_VERTICES * 2; j++) {
 //            Zobrist::zobrist_pris[i][j] = rng.randuint64();
@@ -35,6 +35,7 @@
 #include <cstdint>
 
 #include "FastBoard.h"
+#include "FullBoard.h"
 #include "Random.h"
 
 class Zobrist {
@@ -47,6 +48,9 @@ public:
     static std::array<std::uint64_t, FastBoard::NUM_VERTICES>                    zobrist_ko;
     /// static std::array<std::array<std::uint64_t, FastBoard::NUM_VERTICES * 2>, 2> zobrist_pris;
     /// static std::array<std::uint64_t, 5>                                          zobrist_pass;
+    /// zobrist_symmetry[s][c][v] = zobrist[c][v经过对称变换s之后的点]
+    static std::array<std::array<std::array<std::uint64_t, FastBoard::NUM_VERTICES>, 4>,
+                      FullBoard::NUM_SYMMETRIES>                                 zobrist_symmetry;
 
     static void init_zobrist(Random& rng);
 };
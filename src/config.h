@@ -45,9 +45,13 @@
 
 /*
  * BOARD_SIZE: Define size of the board to compile Leela with, must be an odd
-   number due to winograd tiles
+   number due to winograd tiles. Other sizes are built by defining
+   LEELAZ_BOARD_SIZE, see BOARD_SIZES in CMakeLists.txt.
  */
-static constexpr auto BOARD_SIZE = 7;
+#ifndef LEELAZ_BOARD_SIZE
+#define LEELAZ_BOARD_SIZE 7
+#endif
+static constexpr auto BOARD_SIZE = LEELAZ_BOARD_SIZE;
 static_assert(BOARD_SIZE % 2 == 1,
               "Code assumes odd board size, remove at your own risk!");
 
@@ -1,6 +0,0 @@
-MatrixXcf A = MatrixXcf::Random(4,4);
-ComplexSchur<MatrixXcf> schur(4);
-schur.compute(A);
-cout << "The matrix T in the decomposition of A is:" << endl << schur.matrixT() << endl;
-schur.compute(A.inverse());
-cout << "The matrix T in the decomposition of A^(-1) is:" << endl << schur.matrixT() << endl;
@@ -1,2 +0,0 @@
-Array3d v(0, sqrt(2.)/2, 1);
-cout << v.asin() << endl;
@@ -1,2 +0,0 @@
-ArrayXd v = ArrayXd::LinSpaced(5,0,1);
-cout << cosh(v) << endl;
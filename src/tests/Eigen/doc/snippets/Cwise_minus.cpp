@@ -1,2 +0,0 @@
-Array3d v(1,2,3);
-cout << v-5 << endl;
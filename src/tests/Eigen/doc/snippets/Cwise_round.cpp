@@ -1,3 +0,0 @@
-ArrayXd v = ArrayXd::LinSpaced(7,-2,2);
-cout << v << endl << endl;
-cout << round(v) << endl;
@@ -1,6 +0,0 @@
-MatrixXcf A = MatrixXcf::Random(4,4);
-HessenbergDecomposition<MatrixXcf> hd(4);
-hd.compute(A);
-cout << "The matrix H in the decomposition of A is:" << endl << hd.matrixH() << endl;
-hd.compute(2*A); // re-use hd to compute and store decomposition of 2A
-cout << "The matrix H in the decomposition of 2A is:" << endl << hd.matrixH() << endl;
@@ -1,9 +0,0 @@
-Matrix4d A = Matrix4d::Random(4,4);
-cout << "Here is a random 4x4 matrix:" << endl << A << endl;
-HessenbergDecomposition<Matrix4d> hessOfA(A);
-Matrix4d pm = hessOfA.packedMatrix();
-cout << "The packed matrix M is:" << endl << pm << endl;
-cout << "The upper Hessenberg part corresponds to the matrix H, which is:" 
-     << endl << hessOfA.matrixH() << endl;
-Vector3d hc = hessOfA.householderCoefficients();
-cout << "The vector of Householder coefficients is:" << endl << hc << endl;
@@ -1,4 +0,0 @@
-MatrixXf A = MatrixXf::Random(3, 2);
-VectorXf b = VectorXf::Random(3);
-cout << "The solution using the QR decomposition is:\n"
-     << A.colPivHouseholderQr().solve(b) << endl;
@@ -1,5 +0,0 @@
-int data[] = {1,2,3,4,5,6,7,8,9};
-Map<RowVectorXi> v(data,4);
-cout << "The mapped vector v is: " << v << "\n";
-new (&v) Map<RowVectorXi>(data+4,5);
-cout << "Now v is: " << v << "\n";
\ No newline at end of file
@@ -1,2 +0,0 @@
-Vector3d v(1,2,4);
-cout << v.cwiseSqrt() << endl;
@@ -1,4 +0,0 @@
-Matrix3i m = Matrix3i::Random();
-cout << "Here is the matrix m:" << endl << m << endl;
-cout << "Here are the coefficients on the main diagonal of m:" << endl
-     << m.diagonal() << endl;
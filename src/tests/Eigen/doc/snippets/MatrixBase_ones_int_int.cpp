@@ -1 +0,0 @@
-cout << MatrixXi::Ones(2,3) << endl;
@@ -1,3 +0,0 @@
-Matrix3d m = Matrix3d::Random();
-cout << "Here is the matrix m:" << endl << m << endl;
-cout << "Here is the product of all the coefficients:" << endl << m.prod() << endl;
@@ -1 +0,0 @@
-cout << VectorXi::Random(2) << endl;
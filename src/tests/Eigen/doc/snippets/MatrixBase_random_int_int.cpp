@@ -1 +0,0 @@
-cout << MatrixXi::Random(2,3) << endl;
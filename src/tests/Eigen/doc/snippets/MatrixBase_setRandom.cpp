@@ -1,3 +0,0 @@
-Matrix4i m = Matrix4i::Zero();
-m.col(1).setRandom();
-cout << m << endl;
@@ -1,2 +0,0 @@
-cout << Matrix2d::Zero() << endl;
-cout << RowVector4i::Zero() << endl;
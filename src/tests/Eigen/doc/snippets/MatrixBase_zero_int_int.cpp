@@ -1 +0,0 @@
-cout << MatrixXi::Zero(2,3) << endl;
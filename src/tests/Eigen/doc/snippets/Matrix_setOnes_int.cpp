@@ -1,3 +0,0 @@
-VectorXf v;
-v.setOnes(3);
-cout << v << endl;
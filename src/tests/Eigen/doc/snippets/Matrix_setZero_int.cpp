@@ -1,3 +0,0 @@
-VectorXf v;
-v.setZero(3);
-cout << v << endl;
@@ -1,6 +0,0 @@
-MatrixXf A = MatrixXf::Random(4,4);
-RealSchur<MatrixXf> schur(4);
-schur.compute(A, /* computeU = */ false);
-cout << "The matrix T in the decomposition of A is:" << endl << schur.matrixT() << endl;
-schur.compute(A.inverse(), /* computeU = */ false);
-cout << "The matrix T in the decomposition of A^(-1) is:" << endl << schur.matrixT() << endl;
@@ -1,8 +0,0 @@
-Matrix4d X = Matrix4d::Random(4,4);
-Matrix4d A = X + X.transpose();
-cout << "Here is a random symmetric 4x4 matrix:" << endl << A << endl;
-Tridiagonalization<Matrix4d> triOfA(A);
-Matrix4d pm = triOfA.packedMatrix();
-cout << "The packed matrix M is:" << endl << pm << endl;
-cout << "The diagonal and subdiagonal corresponds to the matrix T, which is:" 
-     << endl << triOfA.matrixT() << endl;
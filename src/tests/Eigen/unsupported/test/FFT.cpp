@@ -1,2 +0,0 @@
-#define test_FFTW test_FFT
-#include "FFTW.cpp"
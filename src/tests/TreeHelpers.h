@@ -0,0 +1,78 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2018-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#ifndef TREEHELPERS_H_INCLUDED
+#define TREEHELPERS_H_INCLUDED
+
+#include <atomic>
+#include <gtest/gtest.h>
+
+#include "config.h"
+#include "FastBoard.h"
+#include "GTP.h"
+#include "NNCache.h"
+#include "Random.h"
+#include "SearchState.h"
+#include "UCTNode.h"
+#include "Zobrist.h"
+
+/*
+    Search trees for the tests, built without a network: expand() does
+    what UCTNode::create_children() does, with a made up network result.
+*/
+
+inline void init_tree_tests() {
+    Random rng(5489);
+    Zobrist::init_zobrist(rng);
+    FastBoard::init_patterns();
+    GTP::setup_default_parameters();
+    cfg_quiet = true;
+}
+
+// Every point the same prior, winrate for the side to move.
+inline NNCache::Netresult uniform_netresult(float winrate) {
+    auto result = NNCache::Netresult{};
+    result.policy.fill(1.0f / NUM_INTERSECTIONS);
+    result.winrate = winrate;
+    return result;
+}
+
+// Gives node its children and its first visit, at the net eval.
+inline void expand(UCTNode& node, SearchState& state,
+                   const NNCache::Netresult& result) {
+    std::atomic<int> nodecount{0};
+    auto eval = 0.0f;
+    auto reply = int{FastBoard::NO_VERTEX};
+    ASSERT_EQ(UCTNode::Expansion::NEEDS_EVAL,
+              node.prepare_expansion(nodecount, state, eval, 0.0f,
+                                     nullptr, reply));
+    node.finish_expansion(nodecount, state, result, false, eval, 0.0f);
+}
+
+#endif
@@ -0,0 +1,243 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2018-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "config.h"
+#include "FastBoard.h"
+#include "Random.h"
+#include "Zobrist.h"
+
+static_assert(BOARD_SIZE >= 7, "the diagrams below need a 7x7 board");
+
+class FastBoardTest : public ::testing::Test {
+protected:
+    static void SetUpTestCase() {
+        Random rng(5489);
+        Zobrist::init_zobrist(rng);
+        FastBoard::init_patterns();
+    }
+
+    // X black, O white, * the point under test (left empty).
+    // Anything outside the diagram is filled with white, so its
+    // edges behave like the edge of the board on any board size.
+    FastBoard make_board(const std::vector<std::string>& rows) {
+        FastBoard board;
+        board.reset_board(BOARD_SIZE);
+        for (int y = 0; y < BOARD_SIZE; y++) {
+            for (int x = 0; x < BOARD_SIZE; x++) {
+                auto c = 'O';
+                if (y < int(rows.size()) && x < int(rows[y].size())) {
+                    c = rows[y][x];
+                }
+                if (c == 'X') {
+                    board.set_state(x, y, FastBoard::BLACK);
+                } else if (c == 'O') {
+                    board.set_state(x, y, FastBoard::WHITE);
+                } else if (c == '*') {
+                    m_point = board.get_vertex(x, y);
+                }
+            }
+        }
+        return board;
+    }
+
+    int m_point;
+};
+
+// True if, in every direction, the black stones within reach of vertex
+// form one unbroken run through it. Those are the shapes the scan models
+// exactly: it counts only the run and up to two empty points past it.
+static bool single_runs(const FastBoard& board, int vertex) {
+    const int dirs[4][2] = {{1, 0}, {0, 1}, {1, 1}, {1, -1}};
+    const auto xy = board.get_xy(vertex);
+    for (const auto& dir : dirs) {
+        for (auto sign : {1, -1}) {
+            auto in_run = true;
+            for (int k = 1; k <= FastBoard::PATTERN_REACH; k++) {
+                const auto x = xy.first + sign * k * dir[0];
+                const auto y = xy.second + sign * k * dir[1];
+                if (x < 0 || x >= BOARD_SIZE || y < 0 || y >= BOARD_SIZE) {
+                    break;
+                }
+                const auto state = board.get_state(x, y);
+                if (in_run && state == FastBoard::BLACK) {
+                    continue;
+                }
+                in_run = false;
+                if (state == FastBoard::WHITE) {
+                    break;
+                }
+                if (state == FastBoard::BLACK) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+TEST_F(FastBoardTest, DoubleThree) {
+    auto board = make_board({".......",
+                             "...X...",
+                             "...X...",
+                             ".XX*...",
+                             ".......",
+                             ".......",
+                             "......."});
+    EXPECT_TRUE(board.is_forbidden(m_point, FastBoard::BLACK));
+    EXPECT_TRUE(board.is_forbidden_scan(m_point, FastBoard::BLACK));
+    EXPECT_FALSE(board.is_forbidden(m_point, FastBoard::WHITE));
+}
+
+// Each four is blocked by the edge on one side, with two empty points on
+// the other. The scan used to miss such fours.
+TEST_F(FastBoardTest, DoubleFour) {
+    auto board = make_board({"...X...",
+                             "...X...",
+                             "...X...",
+                             "XXX*...",
+                             ".......",
+                             ".......",
+                             "......."});
+    EXPECT_TRUE(board.is_forbidden(m_point, FastBoard::BLACK));
+    EXPECT_TRUE(board.is_forbidden_scan(m_point, FastBoard::BLACK));
+}
+
+TEST_F(FastBoardTest, Overline) {
+    auto board = make_board({".......",
+                             ".......",
+                             ".......",
+                             "XXX*XX.",
+                             ".......",
+                             ".......",
+                             "......."});
+    EXPECT_TRUE(board.is_forbidden(m_point, FastBoard::BLACK));
+    EXPECT_TRUE(board.is_forbidden_scan(m_point, FastBoard::BLACK));
+}
+
+TEST_F(FastBoardTest, FiveBesideOverline) {
+    // The five in the row wins even though the column is an overline.
+    auto board = make_board({"....X..",
+                             "....X..",
+                             "....X..",
+                             "XXXX*..",
+                             "....X..",
+                             "....X..",
+                             "......."});
+    EXPECT_FALSE(board.is_forbidden(m_point, FastBoard::BLACK));
+    EXPECT_FALSE(board.is_forbidden_scan(m_point, FastBoard::BLACK));
+}
+
+TEST_F(FastBoardTest, FiveBesideDoubleThree) {
+    auto board = make_board({".......",
+                             "...X...",
+                             "...X...",
+                             ".XX*...",
+                             "...XX..",
+                             "...X.X.",
+                             "......."});
+    EXPECT_FALSE(board.is_forbidden(m_point, FastBoard::BLACK));
+    EXPECT_FALSE(board.is_forbidden_scan(m_point, FastBoard::BLACK));
+}
+
+// The shapes below have gaps, which only the pattern tables see.
+TEST_F(FastBoardTest, DoubleFourInOneLine) {
+    auto board = make_board({".......",
+                             ".......",
+                             ".......",
+                             "X.X*X.X",
+                             ".......",
+                             ".......",
+                             "......."});
+    EXPECT_TRUE(board.is_forbidden(m_point, FastBoard::BLACK));
+}
+
+TEST_F(FastBoardTest, SplitThree) {
+    auto board = make_board({".......",
+                             "....X..",
+                             "....X..",
+                             ".X.X*..",
+                             ".......",
+                             ".......",
+                             "......."});
+    EXPECT_TRUE(board.is_forbidden(m_point, FastBoard::BLACK));
+}
+
+TEST_F(FastBoardTest, ThreeBlockedByOverline) {
+    // Both ways to an open four in the row would run into the stone
+    // on the left and make six, so the row is not a live three.
+    auto board = make_board({".......",
+                             ".....X.",
+                             ".....X.",
+                             "X..XX*.",
+                             ".......",
+                             ".......",
+                             "......."});
+    EXPECT_FALSE(board.is_forbidden(m_point, FastBoard::BLACK));
+}
+
+TEST_F(FastBoardTest, ForbiddenMatchesScan) {
+    Random rng(1);
+    auto checked = 0, forbidden = 0;
+    for (int i = 0; i < 20000; i++) {
+        FastBoard board;
+        board.reset_board(BOARD_SIZE);
+        auto stones = rng.randfix<NUM_INTERSECTIONS / 2>();
+        for (auto j = 0u; j < stones; j++) {
+            auto x = rng.randfix<BOARD_SIZE>();
+            auto y = rng.randfix<BOARD_SIZE>();
+            if (board.get_state(x, y) == FastBoard::EMPTY) {
+                // two black stones to each white one, so that
+                // forbidden shapes come up often enough
+                board.set_state(x, y, j % 3 ? FastBoard::BLACK
+                                            : FastBoard::WHITE);
+            }
+        }
+        for (int vertex = 0; vertex < FastBoard::NUM_VERTICES; vertex++) {
+            if (board.get_state(vertex) != FastBoard::EMPTY) {
+                continue;
+            }
+            EXPECT_FALSE(board.is_forbidden(vertex, FastBoard::WHITE));
+            if (!single_runs(board, vertex)) {
+                continue;
+            }
+            auto expected = board.is_forbidden_scan(vertex, FastBoard::BLACK);
+            EXPECT_EQ(board.is_forbidden(vertex, FastBoard::BLACK), expected)
+                << "at " << board.get_xy(vertex).first
+                << ", " << board.get_xy(vertex).second;
+            checked++;
+            forbidden += expected;
+        }
+    }
+    EXPECT_GT(checked, 0);
+    EXPECT_GT(forbidden, 0);
+}
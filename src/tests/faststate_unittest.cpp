@@ -0,0 +1,148 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2018-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "config.h"
+#include "FastBoard.h"
+#include "FastState.h"
+#include "Random.h"
+#include "Zobrist.h"
+
+class FastStateTest : public ::testing::Test {
+protected:
+    static void SetUpTestCase() {
+        Random rng(5489);
+        Zobrist::init_zobrist(rng);
+        FastBoard::init_patterns();
+    }
+};
+
+// True if vertex is within PATTERN_REACH of move on one of its lines,
+// the only points update_legal_mask looks at after that move.
+static bool on_line_near(const FastBoard& board, int move, int vertex) {
+    auto a = board.get_xy(move);
+    auto b = board.get_xy(vertex);
+    auto dx = b.first - a.first;
+    auto dy = b.second - a.second;
+    auto dist = std::max(std::abs(dx), std::abs(dy));
+    auto on_line = dx == 0 || dy == 0 || std::abs(dx) == std::abs(dy);
+    return on_line && dist <= FastBoard::PATTERN_REACH;
+}
+
+TEST_F(FastStateTest, LegalMaskMatchesRecompute) {
+    Random rng(1);
+    auto forbidden = 0, far_forbidden = 0;
+    for (int game = 0; game < 2000; game++) {
+        FastState state;
+        state.init_game(BOARD_SIZE);
+        while (!state.has_end()) {
+            const auto color = state.get_to_move();
+            const auto& legal = state.get_legal_mask(color);
+            auto pick = rng.randuint64(legal.count());
+            auto idx = 0;
+            while (!legal[idx] || pick-- > 0) {
+                idx++;
+            }
+            auto move = state.board.get_vertex(idx % BOARD_SIZE,
+                                               idx / BOARD_SIZE);
+            state.play_move(move);
+
+            for (int y = 0; y < BOARD_SIZE; y++) {
+                for (int x = 0; x < BOARD_SIZE; x++) {
+                    auto vertex = state.board.get_vertex(x, y);
+                    auto empty =
+                        state.board.get_state(vertex) == FastBoard::EMPTY;
+                    auto black = empty
+                        && !state.board.is_forbidden(vertex, FastBoard::BLACK);
+                    auto i = y * BOARD_SIZE + x;
+                    EXPECT_EQ(state.get_legal_mask(FastBoard::BLACK)[i], black)
+                        << "at " << x << ", " << y
+                        << " after move " << state.get_movenum();
+                    EXPECT_EQ(state.get_legal_mask(FastBoard::WHITE)[i], empty)
+                        << "at " << x << ", " << y
+                        << " after move " << state.get_movenum();
+                    EXPECT_EQ(state.is_move_legal(FastBoard::BLACK, vertex),
+                              black);
+                    if (empty && !black) {
+                        forbidden++;
+                        far_forbidden += !on_line_near(state.board, move, vertex);
+                    }
+                }
+            }
+        }
+    }
+    EXPECT_GT(forbidden, 0);
+    EXPECT_GT(far_forbidden, 0);
+}
+
+// The diagram fills the whole board.
+#if LEELAZ_BOARD_SIZE == 7
+TEST_F(FastStateTest, OnlyForbiddenPointsLeft) {
+    // The last empty point would give black an overline, and nobody
+    // has five.
+    const std::vector<std::string> rows{"XOXOXXO",
+                                        "OXXOXXO",
+                                        "OXOOOOX",
+                                        "XXX.XXO",
+                                        "OOXOOOX",
+                                        "OOXXXOX",
+                                        "XOOXOOX"};
+    FastState state;
+    state.init_game(BOARD_SIZE);
+    std::vector<int> black, white;
+    for (int y = 0; y < BOARD_SIZE; y++) {
+        for (int x = 0; x < BOARD_SIZE; x++) {
+            if (rows[y][x] == 'X') {
+                black.emplace_back(state.board.get_vertex(x, y));
+            } else if (rows[y][x] == 'O') {
+                white.emplace_back(state.board.get_vertex(x, y));
+            }
+        }
+    }
+    ASSERT_EQ(black.size(), white.size());
+    for (auto i = size_t{0}; i < black.size(); i++) {
+        ASSERT_FALSE(state.has_end());
+        state.play_move(black[i]);
+        state.play_move(white[i]);
+    }
+
+    const auto last = state.board.get_vertex(3, 3);
+    EXPECT_EQ(state.get_to_move(), FastBoard::BLACK);
+    EXPECT_FALSE(state.board.game_end());
+    EXPECT_FALSE(state.is_move_legal(FastBoard::BLACK, last));
+    EXPECT_TRUE(state.get_legal_mask(FastBoard::BLACK).none());
+    EXPECT_TRUE(state.has_end());
+    EXPECT_EQ(state.final_score(), -1.0f);
+}
+#endif
@@ -0,0 +1,126 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2018-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+
+#include "config.h"
+#include "FullBoard.h"
+#include "Network.h"
+#include "Random.h"
+#include "Zobrist.h"
+
+class FullBoardTest : public ::testing::Test {
+protected:
+    static void SetUpTestCase() {
+        Random rng(5489);
+        Zobrist::init_zobrist(rng);
+        FastBoard::init_patterns();
+    }
+};
+
+// The key Network uses for the NN cache when symmetries are shared.
+static std::uint64_t cache_key(const FullBoard& board) {
+    const auto sym = board.get_canonical_symmetry();
+    if (sym == Network::IDENTITY_SYMMETRY) {
+        return board.get_hash();
+    }
+    return board.get_symmetry_hash(sym);
+}
+
+// board with every stone moved by the given symmetry
+static FullBoard transform(const FullBoard& board, int symmetry) {
+    FullBoard result;
+    result.reset_board(BOARD_SIZE);
+    result.set_to_move(board.get_to_move());
+    for (int y = 0; y < BOARD_SIZE; y++) {
+        for (int x = 0; x < BOARD_SIZE; x++) {
+            const auto color = board.get_state(x, y);
+            if (color != FastBoard::EMPTY) {
+                auto xy = Network::get_symmetry({x, y}, symmetry);
+                result.update_board(color,
+                                    result.get_vertex(xy.first, xy.second));
+            }
+        }
+    }
+    return result;
+}
+
+static void check_hashes(const FullBoard& board) {
+    EXPECT_EQ(board.get_hash(), board.calc_hash());
+    EXPECT_EQ(board.get_hash(),
+              board.get_symmetry_hash(Network::IDENTITY_SYMMETRY));
+    const auto key = cache_key(board);
+    for (int sym = 0; sym < FullBoard::NUM_SYMMETRIES; sym++) {
+        const auto hash = board.get_symmetry_hash(sym);
+        EXPECT_EQ(hash, board.calc_symmetry_hash(FastBoard::NO_VERTEX, sym));
+
+        const auto moved = transform(board, sym);
+        EXPECT_EQ(hash, moved.calc_hash()) << "symmetry " << sym;
+        EXPECT_EQ(key, cache_key(moved)) << "symmetry " << sym;
+    }
+}
+
+TEST_F(FullBoardTest, SymmetryHashes) {
+    Random rng(1);
+    for (int game = 0; game < 200; game++) {
+        FullBoard board;
+        board.reset_board(BOARD_SIZE);
+        check_hashes(board);
+
+        std::vector<std::pair<int, int>> moves;
+        while (!board.game_end()) {
+            const auto x = rng.randfix<BOARD_SIZE>();
+            const auto y = rng.randfix<BOARD_SIZE>();
+            const auto vertex = board.get_vertex(x, y);
+            if (board.get_state(vertex) != FastBoard::EMPTY) {
+                continue;
+            }
+            const auto color = board.get_to_move();
+            board.update_board(color, vertex);
+            board.set_to_move(!color);
+            moves.emplace_back(color, vertex);
+            check_hashes(board);
+        }
+
+        // and the same on the way back
+        while (!moves.empty()) {
+            const auto move = moves.back();
+            moves.pop_back();
+            board.undo_board(move.first, move.second);
+            board.set_to_move(move.first);
+            check_hashes(board);
+        }
+        FullBoard empty;
+        empty.reset_board(BOARD_SIZE);
+        EXPECT_EQ(board.get_hash(), empty.get_hash());
+    }
+}
@@ -1,6 +1,6 @@
 /*
     This file is part of Leela Zero.
-    Copyright (C) 2017-2019 Gian-Carlo Pascutto and contributors
+    Copyright (C) 2018-2019 Gian-Carlo Pascutto and contributors
 
     Leela Zero is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -27,30 +27,22 @@
     work.
 */
 
-#ifndef SGFPARSER_H_INCLUDED
-#define SGFPARSER_H_INCLUDED
-
-#include <cstddef>
-#include <cstdint>
-#include <climits>
-#include <sstream>
-#include <string>
-#include <vector>
-
-#include "SGFTree.h"
-
-class SGFParser {
-private:
-    static std::string parse_property_name(std::istringstream & strm);
-    static bool parse_property_value(std::istringstream & strm, std::string & result);
-public:
-    static std::string chop_from_file(std::string fname, size_t index);
-    static std::vector<std::string> chop_all(std::string fname,
-                                             size_t stopat = SIZE_MAX);
-    static std::vector<std::string> chop_stream(std::istream& ins,
-                                                size_t stopat = SIZE_MAX);
-    static void parse(std::istringstream & strm, SGFTree * node);
-};
-
-
-#endif
+#include <gtest/gtest.h>
+
+#include "config.h"
+#include "GTPServer.h"
+
+// --server takes a port or the name of a Unix socket. A number that is
+// no port is an error, not a socket name.
+TEST(GTPServerTest, ParsePort) {
+    EXPECT_EQ(0, GTPServer::parse_port("/tmp/leelaz.sock"));
+    EXPECT_EQ(0, GTPServer::parse_port("6000a"));
+    EXPECT_EQ(0, GTPServer::parse_port("-1"));
+    EXPECT_EQ(1, GTPServer::parse_port("1"));
+    EXPECT_EQ(6000, GTPServer::parse_port("6000"));
+    EXPECT_EQ(65535, GTPServer::parse_port("65535"));
+    EXPECT_EQ(80, GTPServer::parse_port("00080"));
+    EXPECT_EQ(-1, GTPServer::parse_port("0"));
+    EXPECT_EQ(-1, GTPServer::parse_port("65536"));
+    EXPECT_EQ(-1, GTPServer::parse_port("99999999999999999999"));
+}
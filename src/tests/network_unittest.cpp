@@ -0,0 +1,220 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2018-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "config.h"
+#include "AsyncEvaluator.h"
+#include "GameState.h"
+#include "GTP.h"
+#include "Network.h"
+#include "Random.h"
+#include "SearchState.h"
+#include "TreeHelpers.h"
+
+constexpr auto CHANNELS = 8;
+constexpr auto BLOCKS = 2;
+
+// A v1 weights file of random numbers, so that no symmetry of a position
+// evaluates like another.
+static void write_weights(const std::string& filename) {
+    auto rng = Random{42};
+    std::ofstream out(filename);
+    auto line = [&](int count, float lo, float hi) {
+        for (auto i = 0; i < count; i++) {
+            const auto u = rng.randuint64(1000000) / 1000000.0f;
+            out << (i ? " " : "") << lo + (hi - lo) * u;
+        }
+        out << "\n";
+    };
+    auto conv = [&](int inputs, int outputs, int size) {
+        line(outputs * inputs * size * size, -0.5f, 0.5f);
+        line(outputs, 0.0f, 0.0f);
+        line(outputs, -0.1f, 0.1f);
+        // variances
+        line(outputs, 0.5f, 1.5f);
+    };
+    out << "1\n";
+    conv(Network::INPUT_CHANNELS, CHANNELS, 3);
+    for (auto i = 0; i < 2 * BLOCKS; i++) {
+        conv(CHANNELS, CHANNELS, 3);
+    }
+    conv(CHANNELS, Network::OUTPUTS_POLICY, 1);
+    line(Network::OUTPUTS_POLICY * NUM_INTERSECTIONS * POTENTIAL_MOVES,
+         -0.5f, 0.5f);
+    line(POTENTIAL_MOVES, -0.1f, 0.1f);
+    conv(CHANNELS, Network::OUTPUTS_VALUE, 1);
+    line(Network::OUTPUTS_VALUE * NUM_INTERSECTIONS * Network::VALUE_LAYER,
+         -0.5f, 0.5f);
+    line(Network::VALUE_LAYER, -0.1f, 0.1f);
+    line(Network::VALUE_LAYER, -0.5f, 0.5f);
+    line(1, -0.1f, 0.1f);
+}
+
+static float max_difference(const Network::Netresult& a,
+                            const Network::Netresult& b) {
+    auto difference = std::abs(a.winrate - b.winrate);
+    for (auto i = 0; i < NUM_INTERSECTIONS; i++) {
+        difference = std::max(difference, std::abs(a.policy[i] - b.policy[i]));
+    }
+    return difference;
+}
+
+class NetworkTest : public ::testing::Test {
+protected:
+    static void SetUpTestCase() {
+        init_tree_tests();
+        const auto filename = std::string{"network_unittest_weights.txt"};
+        write_weights(filename);
+        s_network = std::make_unique<Network>();
+        s_network->initialize(100, filename);
+        std::remove(filename.c_str());
+    }
+
+    static void TearDownTestCase() {
+        s_network.reset();
+    }
+
+    static std::unique_ptr<Network> s_network;
+};
+
+std::unique_ptr<Network> NetworkTest::s_network;
+
+// The positions of a batch go through the Winograd GEMMs together. Each
+// has to come out as if it had been evaluated on its own, under the
+// symmetry the batch picked for it.
+TEST_F(NetworkTest, BatchMatchesSingleEvals) {
+    GameState game;
+    game.init_game(BOARD_SIZE);
+    game.play_move(game.board.get_vertex(3, 3));
+    game.play_move(game.board.get_vertex(2, 3));
+    auto states = std::vector<SearchState>{};
+    for (auto i = 0; i < 6; i++) {
+        states.emplace_back(game);
+        states.back().play_move(states.back().board.get_vertex(i, 0));
+    }
+    auto pointers = std::vector<const SearchState*>{};
+    for (const auto& state : states) {
+        pointers.emplace_back(&state);
+    }
+
+    s_network->nncache_clear();
+    const auto results = s_network->get_output_batch(pointers);
+    ASSERT_EQ(states.size(), results.size());
+    for (auto i = size_t{0}; i < states.size(); i++) {
+        auto best = 1.0f;
+        auto worst = 0.0f;
+        for (auto symmetry = 0; symmetry < Network::NUM_SYMMETRIES;
+             symmetry++) {
+            const auto single = s_network->get_output(
+                &states[i], Network::Ensemble::DIRECT, symmetry, false, false);
+            const auto difference = max_difference(results[i], single);
+            best = std::min(best, difference);
+            worst = std::max(worst, difference);
+        }
+        EXPECT_LT(best, 1e-4f) << "position " << i;
+        // Otherwise any symmetry would do.
+        EXPECT_GT(worst, 1e-3f) << "position " << i;
+    }
+
+    // The batch filled the cache.
+    const auto cached = s_network->get_output_batch(pointers);
+    for (auto i = size_t{0}; i < states.size(); i++) {
+        EXPECT_EQ(0.0f, max_difference(results[i], cached[i]));
+    }
+}
+
+// Pops count completions, or fails after a few seconds instead of hanging.
+static std::vector<AsyncEvaluator::Completion> pop_completions(
+        AsyncEvaluator::CompletionQueue& queue, size_t count) {
+    auto completions = std::vector<AsyncEvaluator::Completion>{};
+    const auto deadline = std::chrono::steady_clock::now()
+                          + std::chrono::seconds(10);
+    while (completions.size() < count
+           && std::chrono::steady_clock::now() < deadline) {
+        auto completion = AsyncEvaluator::Completion{};
+        if (queue.try_pop(completion)) {
+            completions.emplace_back(std::move(completion));
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    return completions;
+}
+
+// More requests than fill a batch and not a multiple of it: a flush has
+// to hold until the last of them is evaluated.
+TEST_F(NetworkTest, EvaluatorFlushDrainsTheQueue) {
+    GameState game;
+    game.init_game(BOARD_SIZE);
+    auto states = std::vector<SearchState>{};
+    for (auto i = 0; i < 10; i++) {
+        states.emplace_back(game);
+        states.back().play_move(
+            states.back().board.get_vertex(i % BOARD_SIZE, i / BOARD_SIZE));
+    }
+
+    for (auto threads = 1; threads <= 2; threads++) {
+        s_network->nncache_clear();
+        LeafBatchStats stats;
+        AsyncEvaluator evaluator(*s_network, 4, threads, &stats);
+        AsyncEvaluator::CompletionQueue queue;
+        for (auto& state : states) {
+            evaluator.submit(&state, &state, queue);
+        }
+        evaluator.flush();
+        const auto completions = pop_completions(queue, states.size());
+        ASSERT_EQ(states.size(), completions.size()) << threads << " threads";
+        EXPECT_EQ(int(states.size()), stats.leaves.load());
+        EXPECT_GE(stats.batches.load(), 3);
+
+        auto seen = std::vector<bool>(states.size(), false);
+        for (const auto& completion : completions) {
+            EXPECT_FALSE(completion.halted);
+            const auto state = static_cast<const SearchState*>(completion.tag);
+            const auto index = size_t(state - states.data());
+            ASSERT_LT(index, states.size());
+            EXPECT_FALSE(seen[index]);
+            seen[index] = true;
+            // The evaluator filled the cache with what it handed out.
+            const auto cached = s_network->get_output_batch(
+                std::vector<const SearchState*>{state});
+            EXPECT_EQ(0.0f, max_difference(cached[0], completion.result));
+        }
+    }
+}
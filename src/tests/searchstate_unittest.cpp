@@ -0,0 +1,118 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2018-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "config.h"
+#include "FastBoard.h"
+#include "FullBoard.h"
+#include "GameState.h"
+#include "Random.h"
+#include "SearchState.h"
+#include "Zobrist.h"
+
+class SearchStateTest : public ::testing::Test {
+protected:
+    static void SetUpTestCase() {
+        Random rng(5489);
+        Zobrist::init_zobrist(rng);
+        FastBoard::init_patterns();
+    }
+
+    // The history planes of the network, which GameState keeps in full.
+    static void expect_same_history(const SearchState& state,
+                                    const GameState& game) {
+        ASSERT_EQ(game.get_movenum(), state.get_movenum());
+        const auto moves = std::min<size_t>(game.get_movenum() + 1,
+                                            LAYER_INPUT_MOVES);
+        for (auto h = 0; h < int(moves); h++) {
+            const auto& expected = game.get_past_board(h);
+            const auto& past = state.get_past_board(h);
+            EXPECT_EQ(expected.get_to_move(), past.get_to_move());
+            for (auto y = 0; y < BOARD_SIZE; y++) {
+                for (auto x = 0; x < BOARD_SIZE; x++) {
+                    ASSERT_EQ(expected.get_state(x, y), past.get_state(x, y))
+                        << h << " moves ago";
+                }
+            }
+        }
+    }
+
+    static int random_move(const FastState& state, Random& rng) {
+        auto moves = std::vector<int>{};
+        for (auto i = 0; i < NUM_INTERSECTIONS; i++) {
+            auto vertex = state.board.get_vertex(i % BOARD_SIZE,
+                                                 i / BOARD_SIZE);
+            if (state.board.get_state(vertex) == FastBoard::EMPTY
+                && state.is_move_legal(state.get_to_move(), vertex)) {
+                moves.push_back(vertex);
+            }
+        }
+        return moves[rng.randuint64(moves.size())];
+    }
+};
+
+// Down a random line and back up, with the root early enough that part
+// of the history is from before it.
+TEST_F(SearchStateTest, HistoryRingFollowsPlayAndUndo) {
+    Random rng(1234);
+    for (auto root_moves = 0; root_moves < 4; root_moves++) {
+        GameState game;
+        game.init_game(BOARD_SIZE);
+        for (auto i = 0; i < root_moves; i++) {
+            game.play_move(random_move(game, rng));
+        }
+        SearchState state(game);
+        expect_same_history(state, game);
+
+        for (auto pass = 0; pass < 2; pass++) {
+            auto depth = 0;
+            while (depth < 3 * LAYER_INPUT_MOVES && !game.has_end()) {
+                auto move = random_move(game, rng);
+                game.play_move(move);
+                state.play_move(move);
+                depth++;
+                expect_same_history(state, game);
+            }
+            // Half way up, then all of it.
+            for (auto i = 0; i < depth / 2; i++) {
+                game.undo_move();
+                state.undo_move();
+                expect_same_history(state, game);
+            }
+            for (auto i = depth / 2; i < depth; i++) {
+                game.undo_move();
+            }
+            state.rewind();
+            expect_same_history(state, game);
+        }
+    }
+}
@@ -0,0 +1,164 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2018-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include <algorithm>
+#include <functional>
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "config.h"
+#include "FastBoard.h"
+#include "GameState.h"
+#include "GTP.h"
+#include "SearchState.h"
+#include "SequentialHalving.h"
+#include "UCTNode.h"
+#include "TreeHelpers.h"
+
+class SequentialHalvingTest : public ::testing::Test {
+protected:
+    static void SetUpTestCase() {
+        init_tree_tests();
+    }
+
+    void SetUp() override {
+        GameState game;
+        game.init_game(BOARD_SIZE);
+        SearchState state(game);
+        m_root.reset(new UCTNode(FastBoard::PASS, 0.0f));
+        expand(*m_root, state, uniform_netresult(0.5f));
+        m_root->inflate_all_children();
+    }
+
+    void TearDown() override {
+        cfg_gumbel_m = 16;
+    }
+
+    // One simulation. The moves the search picks get the values in
+    // VALUES, in the order they are first picked.
+    void simulate() {
+        static const float VALUES[] = {0.0f, 1.0f, 0.2f, 0.8f};
+        const auto index = m_halving.select(*m_root, nullptr);
+        const auto move = m_root->get_children()[index].get_move();
+        if (!m_values.count(move)) {
+            ASSERT_LT(m_values.size(), 4u);
+            m_values[move] = VALUES[m_values.size()];
+        }
+        const auto eval = m_values[move];
+        m_root->get_children()[index]->update(eval);
+        m_root->update_child(index, true, eval);
+        m_root->update(eval);
+    }
+
+    // Visits of the children, most first.
+    std::vector<int> visits() const {
+        auto result = std::vector<int>{};
+        for (const auto& child : m_root->get_children()) {
+            result.emplace_back(child.get_visits());
+        }
+        std::sort(begin(result), end(result), std::greater<int>());
+        return result;
+    }
+
+    std::unique_ptr<UCTNode> m_root;
+    SequentialHalving m_halving;
+    std::map<int, float> m_values;
+};
+
+// 4 moves and 40 visits: 2 phases. The 4 moves get 40 / (2 * 4) visits
+// each, then the best 2 get 40 / (2 * 2) more.
+TEST_F(SequentialHalvingTest, VisitSchedule) {
+    cfg_gumbel_m = 4;
+    m_halving.start(*m_root, FastBoard::BLACK, 40);
+    ASSERT_TRUE(m_halving.active());
+
+    for (auto i = 0; i < 20; i++) {
+        simulate();
+    }
+    auto expected = std::vector<int>(NUM_INTERSECTIONS, 0);
+    std::fill_n(begin(expected), 4, 5);
+    EXPECT_EQ(expected, visits());
+
+    for (auto i = 0; i < 20; i++) {
+        simulate();
+    }
+    expected[0] = expected[1] = 15;
+    EXPECT_EQ(expected, visits());
+    for (const auto& child : m_root->get_children()) {
+        if (child.get_visits() == 15) {
+            EXPECT_GE(m_values[child.get_move()], 0.8f);
+        }
+    }
+
+    // The better of the last two is played.
+    simulate();
+    const auto best = m_halving.get_best_move(*m_root);
+    EXPECT_EQ(1.0f, m_values[best]);
+    m_halving.stop();
+    EXPECT_FALSE(m_halving.active());
+}
+
+// The training target is a distribution over all the children, which
+// the visited moves with the best values lead.
+TEST_F(SequentialHalvingTest, ImprovedPolicyIsNormalized) {
+    cfg_gumbel_m = 4;
+    m_halving.start(*m_root, FastBoard::BLACK, 40);
+    for (auto i = 0; i < 40; i++) {
+        simulate();
+    }
+    const auto& children = m_root->get_children();
+    const auto policy = m_halving.get_improved_policy(*m_root);
+    ASSERT_EQ(children.size(), policy.size());
+    EXPECT_NEAR(1.0f, std::accumulate(begin(policy), end(policy), 0.0f),
+                1e-5f);
+
+    auto best = size_t{0};
+    for (auto i = size_t{0}; i < policy.size(); i++) {
+        EXPECT_GT(policy[i], 0.0f);
+        if (policy[i] > policy[best]) {
+            best = i;
+        }
+    }
+    EXPECT_EQ(1.0f, m_values[children[best].get_move()]);
+
+    // Unvisited moves all get the mixed value, and so the same weight.
+    auto unvisited = std::vector<float>{};
+    for (auto i = size_t{0}; i < policy.size(); i++) {
+        if (children[i].get_visits() == 0) {
+            unvisited.emplace_back(policy[i]);
+        }
+    }
+    ASSERT_EQ(NUM_INTERSECTIONS - 4, int(unvisited.size()));
+    for (const auto p : unvisited) {
+        EXPECT_FLOAT_EQ(unvisited.front(), p);
+    }
+}
@@ -0,0 +1,100 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2018-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "config.h"
+#include "FastBoard.h"
+#include "StripedStats.h"
+#include "UCTNode.h"
+
+// More threads than stripes, so that some of them share one.
+constexpr auto THREADS = Striped::STRIPES + 8;
+
+TEST(StripedStatsTest, CounterMatchesPlainCounter) {
+    StripedCounter counter;
+    std::atomic<int> plain{0};
+    auto threads = std::vector<std::thread>{};
+    for (auto t = 0; t < THREADS; t++) {
+        threads.emplace_back([&counter, &plain, t]() {
+            for (auto i = 0; i < 1000; i++) {
+                counter.add(1 + (i + t) % 3);
+                plain += 1 + (i + t) % 3;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(plain.load(), counter.load());
+    counter.clear();
+    EXPECT_EQ(0, counter.load());
+}
+
+// Every thread backs up its own evals through a striped node. The sums
+// and the variance come out as those of a plain node given all of them.
+TEST(StripedStatsTest, StripedNodeMatchesPlainNode) {
+    auto eval_of = [](int t, int i) {
+        return float((t * 7 + i * 13) % 11) / 10.0f;
+    };
+    UCTNode striped(FastBoard::PASS, 0.0f);
+    UCTNode plain(FastBoard::PASS, 0.0f);
+    // The visits from before the striping stay in the node itself.
+    for (auto i = 0; i < 10; i++) {
+        striped.update(eval_of(THREADS, i));
+        plain.update(eval_of(THREADS, i));
+    }
+    striped.enable_striping();
+
+    auto threads = std::vector<std::thread>{};
+    for (auto t = 0; t < THREADS; t++) {
+        threads.emplace_back([&striped, &eval_of, t]() {
+            for (auto i = 0; i < 500; i++) {
+                striped.update(eval_of(t, i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto t = 0; t < THREADS; t++) {
+        for (auto i = 0; i < 500; i++) {
+            plain.update(eval_of(t, i));
+        }
+    }
+
+    EXPECT_EQ(plain.get_visits(), striped.get_visits());
+    EXPECT_NEAR(plain.get_raw_eval(FastBoard::BLACK),
+                striped.get_raw_eval(FastBoard::BLACK), 1e-5f);
+    EXPECT_NEAR(plain.get_eval_variance(), striped.get_eval_variance(),
+                1e-3f * plain.get_eval_variance());
+}
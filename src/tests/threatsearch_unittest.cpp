@@ -0,0 +1,189 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2018-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "config.h"
+#include "FastBoard.h"
+#include "FastState.h"
+#include "Random.h"
+#include "ThreatSearch.h"
+#include "Zobrist.h"
+
+static_assert(BOARD_SIZE >= 7, "the diagrams below need a 7x7 board");
+
+constexpr auto NODES = 500;
+
+class ThreatSearchTest : public ::testing::Test {
+protected:
+    static void SetUpTestCase() {
+        Random rng(5489);
+        Zobrist::init_zobrist(rng);
+        FastBoard::init_patterns();
+    }
+
+    // X black, O white, the first row is row 1. On a bigger board the
+    // rest is filled with stones that never make more than two in a row.
+    FastState make_state(const std::vector<std::string>& rows, int to_move) {
+        FastState state;
+        state.init_game(BOARD_SIZE);
+        for (int y = 0; y < BOARD_SIZE; y++) {
+            for (int x = 0; x < BOARD_SIZE; x++) {
+                auto c = (x / 2 + y) % 2 ? 'X' : 'O';
+                if (y < int(rows.size()) && x < int(rows[y].size())) {
+                    c = rows[y][x];
+                }
+                if (c == 'X') {
+                    state.board.set_state(x, y, FastBoard::BLACK);
+                } else if (c == 'O') {
+                    state.board.set_state(x, y, FastBoard::WHITE);
+                }
+            }
+        }
+        state.set_to_move(to_move);
+        return state;
+    }
+};
+
+TEST_F(ThreatSearchTest, FiveOnBoard) {
+    auto state = make_state({".......",
+                             ".......",
+                             ".......",
+                             ".OOOO..",
+                             ".......",
+                             "X.X.X.X",
+                             "......."}, FastBoard::WHITE);
+    ThreatSearch threats{state, NODES, 0};
+    EXPECT_EQ(threats.solve(), ThreatSearch::WIN);
+    auto move = threats.get_best_move();
+    EXPECT_TRUE(move == state.board.get_vertex(0, 3)
+                || move == state.board.get_vertex(5, 3));
+}
+
+TEST_F(ThreatSearchTest, VcfDoubleFour) {
+    // White's only winning move is C7, making two fours. Black can
+    // block just one of them.
+    auto state = make_state({"X.....X",
+                             "..X....",
+                             ".......",
+                             "..O....",
+                             "..O....",
+                             "..O....",
+                             "...OOOX"}, FastBoard::WHITE);
+    ThreatSearch threats{state, NODES, 0};
+    EXPECT_EQ(threats.solve(), ThreatSearch::WIN);
+    EXPECT_EQ(threats.get_best_move(), state.board.get_vertex(2, 6));
+}
+
+TEST_F(ThreatSearchTest, VcfFourThree) {
+    // Black makes a four and an open three at once. After white blocks
+    // the four, the three becomes an open four.
+    auto state = make_state({"O......",
+                             "...X...",
+                             "...X...",
+                             "...X...",
+                             ".......",
+                             "XXX...O",
+                             "......."}, FastBoard::BLACK);
+    ThreatSearch threats{state, NODES, 0};
+    EXPECT_EQ(threats.solve(), ThreatSearch::WIN);
+}
+
+TEST_F(ThreatSearchTest, VctDoubleThree) {
+    // Two open threes at E4, which white may play. Black has no four to
+    // answer with, so it is a win with threes but not with fours alone.
+    auto state = make_state({"X.....X",
+                             "....O..",
+                             "....O..",
+                             "..OO...",
+                             ".......",
+                             ".......",
+                             "X.....X"}, FastBoard::WHITE);
+    ThreatSearch vcf{state, NODES, 0};
+    EXPECT_EQ(vcf.solve(), ThreatSearch::UNKNOWN);
+    ThreatSearch vct{state, NODES, 1};
+    EXPECT_EQ(vct.solve(), ThreatSearch::WIN);
+    EXPECT_EQ(vct.get_best_move(), state.board.get_vertex(4, 3));
+}
+
+TEST_F(ThreatSearchTest, OpenFourIsLost) {
+    auto state = make_state({".......",
+                             ".......",
+                             ".OOOO..",
+                             ".......",
+                             "X......",
+                             "..X....",
+                             "X...X.."}, FastBoard::BLACK);
+    ThreatSearch threats{state, NODES, 0};
+    EXPECT_EQ(threats.solve(), ThreatSearch::LOSS);
+}
+
+TEST_F(ThreatSearchTest, ForbiddenBlockIsLost) {
+    // White's five point E1 would be a double four for black.
+    auto state = make_state({"OOOO...",
+                             "...XX..",
+                             "..X.X..",
+                             ".X..X..",
+                             ".......",
+                             ".......",
+                             "......O"}, FastBoard::BLACK);
+    const auto block = state.board.get_vertex(4, 0);
+    ASSERT_TRUE(state.board.is_forbidden(block, FastBoard::BLACK));
+    ThreatSearch threats{state, NODES, 1};
+    EXPECT_EQ(threats.solve(), ThreatSearch::LOSS);
+}
+
+TEST_F(ThreatSearchTest, NoWin) {
+    auto state = make_state({".......",
+                             ".......",
+                             "..X.O..",
+                             "...O...",
+                             "..X....",
+                             ".......",
+                             "......."}, FastBoard::BLACK);
+    ThreatSearch threats{state, NODES, 1};
+    EXPECT_EQ(threats.solve(), ThreatSearch::UNKNOWN);
+    EXPECT_EQ(threats.get_best_move(), FastBoard::PASS);
+}
+
+TEST_F(ThreatSearchTest, OutOfBudget) {
+    // The double three needs more than one node to prove, running out
+    // loses the proof but never claims a wrong result.
+    auto state = make_state({"X.....X",
+                             "....O..",
+                             "....O..",
+                             "..OO...",
+                             ".......",
+                             ".......",
+                             "X.....X"}, FastBoard::WHITE);
+    ThreatSearch threats{state, 1, 1};
+    EXPECT_EQ(threats.solve(), ThreatSearch::UNKNOWN);
+}
@@ -0,0 +1,85 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2018-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include <gtest/gtest.h>
+#include <sstream>
+
+#include "config.h"
+#include "Network.h"
+#include "Random.h"
+#include "Training.h"
+
+static TimeStep random_timestep(Random& rng, bool full_search) {
+    auto step = TimeStep{};
+    for (auto p = 0; p < Network::INPUT_CHANNELS; p++) {
+        auto plane = TimeStep::BoardPlane{};
+        for (auto i = 0; i < NUM_INTERSECTIONS; i++) {
+            plane[i] = rng.randfix<2>();
+        }
+        step.planes.emplace_back(plane);
+    }
+    for (auto i = 0; i < POTENTIAL_MOVES; i++) {
+        step.probabilities.emplace_back(rng.randfix<100>() / 100.0f);
+    }
+    step.to_move = rng.randfix<2>();
+    step.net_winrate = 0.25f;
+    step.root_uct_winrate = 0.5f;
+    step.child_uct_winrate = 0.75f;
+    step.bestmove_visits = 123;
+    step.full_search = full_search;
+    return step;
+}
+
+static void expect_equal(const TimeStep& a, const TimeStep& b) {
+    EXPECT_EQ(a.planes, b.planes);
+    EXPECT_EQ(a.probabilities, b.probabilities);
+    EXPECT_EQ(a.to_move, b.to_move);
+    EXPECT_EQ(a.net_winrate, b.net_winrate);
+    EXPECT_EQ(a.root_uct_winrate, b.root_uct_winrate);
+    EXPECT_EQ(a.child_uct_winrate, b.child_uct_winrate);
+    EXPECT_EQ(a.bestmove_visits, b.bestmove_visits);
+    EXPECT_EQ(a.full_search, b.full_search);
+}
+
+// save_training and load_training go through these. A fast search move
+// has to stay one, or its policy becomes a training target.
+TEST(TrainingTest, TimeStepRoundTrip) {
+    Random rng(5489);
+    const auto full = random_timestep(rng, true);
+    const auto fast = random_timestep(rng, false);
+
+    std::stringstream stream;
+    stream << full << fast;
+    auto full_in = TimeStep{};
+    auto fast_in = TimeStep{};
+    stream >> full_in >> fast_in;
+    ASSERT_FALSE(stream.fail());
+    expect_equal(full, full_in);
+    expect_equal(fast, fast_in);
+}
@@ -0,0 +1,136 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2018-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include <gtest/gtest.h>
+#include <memory>
+
+#include "config.h"
+#include "FastBoard.h"
+#include "GameState.h"
+#include "SearchState.h"
+#include "TranspositionTable.h"
+#include "UCTNode.h"
+#include "TreeHelpers.h"
+
+class TranspositionTableTest : public ::testing::Test {
+protected:
+    static void SetUpTestCase() {
+        init_tree_tests();
+    }
+};
+
+TEST_F(TranspositionTableTest, OneNodePerHash) {
+    TranspositionTable table;
+    const auto node = table.get_node(1234);
+    EXPECT_EQ(node, table.get_node(1234));
+    // Same shard, other position.
+    EXPECT_NE(node, table.get_node(1234 + 64));
+    EXPECT_EQ(2u, table.size());
+
+    auto released = table.release_node(1234);
+    EXPECT_EQ(node, released.get());
+    EXPECT_EQ(1u, table.size());
+    EXPECT_EQ(nullptr, table.release_node(1234));
+    EXPECT_NE(node, table.get_node(1234));
+    EXPECT_EQ(2u, table.size());
+}
+
+TEST_F(TranspositionTableTest, RetainReachable) {
+    GameState game;
+    game.init_game(BOARD_SIZE);
+    SearchState state(game);
+    UCTNode root(FastBoard::PASS, 0.0f);
+    expand(root, state, uniform_netresult(0.5f));
+
+    TranspositionTable table;
+    const auto& children = root.get_children();
+    for (auto i = 0; i < 2; i++) {
+        state.play_move(children[i].get_move());
+        EXPECT_TRUE(children[i].link(table.get_node(state.board.get_hash())));
+        state.undo_move();
+    }
+    table.get_node(1234);
+    EXPECT_EQ(3u, table.size());
+
+    table.retain_reachable(root);
+    EXPECT_EQ(2u, table.size());
+    EXPECT_EQ(nullptr, table.release_node(1234));
+}
+
+// Two parents link to one shared node. Each counts the visits through
+// its own link, at the value the shared node has now.
+TEST_F(TranspositionTableTest, UpdateFromChildren) {
+    GameState game;
+    game.init_game(BOARD_SIZE);
+    SearchState state(game);
+    UCTNode parent_a(FastBoard::PASS, 0.0f);
+    UCTNode parent_b(FastBoard::PASS, 0.0f);
+    // Black to move: net evals of 0.6 and 0.4 for black.
+    expand(parent_a, state, uniform_netresult(0.6f));
+    expand(parent_b, state, uniform_netresult(0.4f));
+
+    TranspositionTable table;
+    const auto move = parent_a.get_children()[0].get_move();
+    state.play_move(move);
+    const auto shared = table.get_node(state.board.get_hash());
+    // White to move, 0.8 for black.
+    expand(*shared, state, uniform_netresult(0.2f));
+    state.undo_move();
+    parent_a.get_children()[0].link(shared);
+    parent_b.get_children()[0].link(shared);
+
+    // A simulation through a that found a black win below the shared node.
+    const auto shares = std::vector<std::pair<std::size_t, float>>{{0, 1.0f}};
+    EXPECT_EQ(0u, parent_a.share_select_child(shares));
+    shared->update(1.0f);
+    parent_a.update_child(0, true, 1.0f);
+    parent_a.update_from_children();
+    EXPECT_EQ(2, shared->get_visits());
+    EXPECT_EQ(2, parent_a.get_visits());
+    EXPECT_NEAR(0.6f + 0.9f, 2 * parent_a.get_raw_eval(FastBoard::BLACK),
+                1e-5f);
+
+    // Three through b that found black losses.
+    for (auto i = 0; i < 3; i++) {
+        EXPECT_EQ(0u, parent_b.share_select_child(shares));
+        shared->update(0.0f);
+        parent_b.update_child(0, true, 0.0f);
+        parent_b.update_from_children();
+    }
+    EXPECT_EQ(5, shared->get_visits());
+    EXPECT_EQ(4, parent_b.get_visits());
+    EXPECT_NEAR(0.4f + 3 * 0.36f, 4 * parent_b.get_raw_eval(FastBoard::BLACK),
+                1e-5f);
+
+    // a still counts its one visit, at the shared node's value now.
+    parent_a.update_from_children();
+    EXPECT_EQ(2, parent_a.get_visits());
+    EXPECT_NEAR(0.6f + 0.36f, 2 * parent_a.get_raw_eval(FastBoard::BLACK),
+                1e-5f);
+}
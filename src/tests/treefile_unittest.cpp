@@ -0,0 +1,208 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2018-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "config.h"
+#include "FastBoard.h"
+#include "GameState.h"
+#include "Random.h"
+#include "SearchState.h"
+#include "TreeFile.h"
+#include "UCTNode.h"
+#include "TreeHelpers.h"
+
+// Deep enough for a tree of a few levels, too shallow for a four.
+constexpr auto MAX_DEPTH = 4;
+
+class TreeFileTest : public ::testing::Test {
+protected:
+    static void SetUpTestCase() {
+        init_tree_tests();
+    }
+
+    void SetUp() override {
+        m_filename = "treefile_unittest.tree";
+        m_game.init_game(BOARD_SIZE);
+        m_game.play_move(m_game.board.get_vertex(3, 3));
+        m_root = std::make_unique<UCTNode>(FastBoard::PASS, 0.0f);
+        auto state = SearchState(m_game);
+        auto rng = Random(99);
+        for (auto i = 0; i < 300; i++) {
+            simulate(*m_root, state, rng, 0);
+        }
+        m_root->get_children()[1]->set_proven(0.0f);
+        m_root->refresh_child_stats();
+        ASSERT_TRUE(TreeFile::save(m_filename, *m_root, m_game));
+    }
+
+    void TearDown() override {
+        std::remove(m_filename.c_str());
+    }
+
+    // A simulation like UCTSearch::play_simulation(), with made up evals.
+    static float simulate(UCTNode& node, SearchState& state, Random& rng,
+                          int depth) {
+        if (!node.has_children()) {
+            const auto winrate = rng.randuint64(101) / 100.0f;
+            expand(node, state, uniform_netresult(winrate));
+            return node.get_net_eval(FastBoard::BLACK);
+        }
+        const auto color = state.get_to_move();
+        auto eval = node.get_net_eval(FastBoard::BLACK);
+        if (depth < MAX_DEPTH) {
+            const auto index = node.uct_select_child(color, depth == 0);
+            const auto& child = node.get_children()[index];
+            state.play_move(child.get_move());
+            eval = simulate(*child, state, rng, depth + 1);
+            state.undo_move();
+            node.update_child(index, true, eval);
+        }
+        node.update(eval);
+        return eval;
+    }
+
+    static void expect_same_tree(const UCTNode& a, const UCTNode& b) {
+        EXPECT_EQ(a.get_move(), b.get_move());
+        EXPECT_EQ(a.get_visits(), b.get_visits());
+        EXPECT_FLOAT_EQ(a.get_net_eval(FastBoard::BLACK),
+                        b.get_net_eval(FastBoard::BLACK));
+        if (a.get_visits() > 0) {
+            EXPECT_FLOAT_EQ(a.get_raw_eval(FastBoard::BLACK),
+                            b.get_raw_eval(FastBoard::BLACK));
+        }
+        EXPECT_EQ(a.is_proven(), b.is_proven());
+        const auto& a_children = a.get_children();
+        const auto& b_children = b.get_children();
+        ASSERT_EQ(a_children.size(), b_children.size());
+        for (auto i = size_t{0}; i < a_children.size(); i++) {
+            EXPECT_EQ(a_children[i].get_move(), b_children[i].get_move());
+            EXPECT_EQ(a_children[i].get_policy(), b_children[i].get_policy());
+            EXPECT_EQ(a_children[i].get_visits(), b_children[i].get_visits());
+            if (a_children[i].get_visits() > 0) {
+                ASSERT_TRUE(b_children[i].is_inflated());
+                expect_same_tree(*a_children[i], *b_children[i]);
+            }
+        }
+    }
+
+    std::vector<char> read_file() const {
+        std::ifstream in(m_filename, std::ios::binary);
+        return {std::istreambuf_iterator<char>(in),
+                std::istreambuf_iterator<char>()};
+    }
+
+    void write_file(const std::vector<char>& bytes) const {
+        std::ofstream out(m_filename, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), bytes.size());
+    }
+
+    std::unique_ptr<UCTNode> load() const {
+        auto rootstate = std::unique_ptr<GameState>{};
+        return TreeFile::load(m_filename, m_game, rootstate);
+    }
+
+    std::string m_filename;
+    GameState m_game;
+    std::unique_ptr<UCTNode> m_root;
+};
+
+TEST_F(TreeFileTest, RoundTrip) {
+    auto rootstate = std::unique_ptr<GameState>{};
+    auto loaded = TreeFile::load(m_filename, m_game, rootstate);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(300, loaded->get_visits());
+    ASSERT_NE(nullptr, rootstate);
+    EXPECT_EQ(m_game.board.get_hash(), rootstate->board.get_hash());
+    expect_same_tree(*m_root, *loaded);
+}
+
+// A tree saved earlier in the same game is loaded at its own position.
+TEST_F(TreeFileTest, LoadLaterInTheGame) {
+    auto later = m_game;
+    later.play_move(later.board.get_vertex(2, 2));
+    auto rootstate = std::unique_ptr<GameState>{};
+    auto loaded = TreeFile::load(m_filename, later, rootstate);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(m_game.get_movenum(), rootstate->get_movenum());
+
+    auto other = GameState{};
+    other.init_game(BOARD_SIZE);
+    other.play_move(other.board.get_vertex(1, 1));
+    EXPECT_EQ(nullptr, TreeFile::load(m_filename, other, rootstate));
+}
+
+TEST_F(TreeFileTest, RejectCorruptFiles) {
+    const auto good = read_file();
+    // Header, then records of 40 bytes.
+    constexpr auto HEADER = size_t{32};
+    constexpr auto RECORD = size_t{40};
+    ASSERT_EQ(0u, (good.size() - HEADER) % RECORD);
+
+    auto bytes = good;
+    bytes.resize(bytes.size() - 1);
+    write_file(bytes);
+    EXPECT_EQ(nullptr, load());
+
+    bytes = good;
+    bytes[0] = 'X';
+    write_file(bytes);
+    EXPECT_EQ(nullptr, load());
+
+    // The root's children don't start right after it.
+    bytes = good;
+    auto first_child = std::uint32_t{2};
+    std::memcpy(&bytes[HEADER + 28], &first_child, sizeof(first_child));
+    write_file(bytes);
+    EXPECT_EQ(nullptr, load());
+
+    // A child off the board.
+    bytes = good;
+    auto move = std::int16_t{FastBoard::NUM_VERTICES + 5};
+    std::memcpy(&bytes[HEADER + RECORD + 36], &move, sizeof(move));
+    write_file(bytes);
+    EXPECT_EQ(nullptr, load());
+
+    // Negative visits.
+    bytes = good;
+    auto visits = std::int32_t{-1};
+    std::memcpy(&bytes[HEADER + 8], &visits, sizeof(visits));
+    write_file(bytes);
+    EXPECT_EQ(nullptr, load());
+
+    write_file(good);
+    EXPECT_NE(nullptr, load());
+}
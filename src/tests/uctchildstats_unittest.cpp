@@ -0,0 +1,158 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2018-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "config.h"
+#include "FastBoard.h"
+#include "Random.h"
+#include "UCTChildStats.h"
+
+// Fills every field from a few values each, so that ties are common.
+static void fill_random(UCTChildStats& stats, Random& rng) {
+    const auto policies = std::vector<float>{0.0f, 0.05f, 0.1f, 0.25f};
+    for (auto i = size_t{0}; i < stats.size(); i++) {
+        const auto policy = policies[rng.randuint64(policies.size())];
+        const auto visits = int(rng.randuint64(4)) * 3;
+        const auto blackevals = double(rng.randuint64(visits + 1));
+        const auto r = rng.randuint64(16);
+        const auto proven = r == 0 ? 1.0f : r == 1 ? -1.0f : 0.0f;
+        const auto active = rng.randuint64(8) != 0;
+        if (rng.randuint64(4) == 0) {
+            stats.set_shared(i, policy, float(rng.randuint64(3)) / 2.0f,
+                             proven, active);
+            for (auto v = 0; v < visits; v++) {
+                stats.add_visit(i, rng.randuint64(3) / 2.0f);
+            }
+        } else {
+            stats.set(i, policy, visits, blackevals, proven, active);
+        }
+        if (rng.randuint64(3) == 0) {
+            stats.add_virtual_loss(i, 3 * int(1 + rng.randuint64(2)));
+        }
+    }
+}
+
+static void expect_same_kernels(const UCTChildStats& stats, int color,
+                                float fpu, float expanding, float scale) {
+    const auto best = stats.select(color, fpu, expanding, scale);
+    EXPECT_LT(best, stats.size());
+    EXPECT_EQ(stats.select_scalar(color, fpu, expanding, scale), best);
+
+    int visits, scalar_visits;
+    float policy, scalar_policy;
+    stats.get_totals(visits, policy);
+    stats.get_totals_scalar(scalar_visits, scalar_policy);
+    EXPECT_EQ(scalar_visits, visits);
+    // Summed in another order.
+    EXPECT_NEAR(scalar_policy, policy, 1e-5f);
+}
+
+TEST(UCTChildStatsTest, KernelsAgree) {
+    Random rng(1234);
+    for (auto round = 0; round < 2000; round++) {
+        UCTChildStats stats;
+        stats.resize(1 + rng.randuint64(40));
+        fill_random(stats, rng);
+        const auto color = rng.randuint64(2) ? FastBoard::WHITE
+                                             : FastBoard::BLACK;
+        const auto fpu = rng.randuint64(3) / 2.0f;
+        const auto expanding = rng.randuint64(2) ? 0.0f : fpu;
+        const auto scale = rng.randuint64(2) ? 0.0f : 2.0f;
+        expect_same_kernels(stats, color, fpu, expanding, scale);
+    }
+}
+
+TEST(UCTChildStatsTest, TiesGoToTheFirstChild) {
+    for (auto count : {1, 7, 8, 9, 17}) {
+        UCTChildStats stats;
+        stats.resize(count);
+        for (auto i = 0; i < count; i++) {
+            stats.set(i, 0.1f, 2, 1.0, 0.0f, true);
+        }
+        EXPECT_EQ(0u, stats.select(FastBoard::BLACK, 0.5f, 0.0f, 1.0f));
+        EXPECT_EQ(0u, stats.select_scalar(FastBoard::BLACK, 0.5f, 0.0f, 1.0f));
+
+        // A tie between the last two, which are in different vectors.
+        if (count >= 9) {
+            stats.set(count - 2, 0.1f, 2, 2.0, 0.0f, true);
+            stats.set(count - 1, 0.1f, 2, 2.0, 0.0f, true);
+            expect_same_kernels(stats, FastBoard::BLACK, 0.5f, 0.0f, 1.0f);
+            EXPECT_EQ(size_t(count - 2),
+                      stats.select(FastBoard::BLACK, 0.5f, 0.0f, 1.0f));
+        }
+    }
+}
+
+TEST(UCTChildStatsTest, ProvenAndPrunedChildren) {
+    UCTChildStats stats;
+    stats.resize(10);
+    for (auto i = 0; i < 10; i++) {
+        stats.set(i, 0.1f, 4, 2.0, 0.0f, true);
+    }
+    // The best by value, but pruned.
+    stats.set(2, 0.5f, 4, 4.0, 0.0f, false);
+    expect_same_kernels(stats, FastBoard::BLACK, 0.5f, 0.0f, 1.0f);
+    EXPECT_NE(2u, stats.select(FastBoard::BLACK, 0.5f, 0.0f, 1.0f));
+
+    // A proven win for the side to move beats any value.
+    stats.set(9, 0.0f, 4, 0.0, -1.0f, true);
+    expect_same_kernels(stats, FastBoard::WHITE, 0.5f, 0.0f, 1.0f);
+    EXPECT_EQ(9u, stats.select(FastBoard::WHITE, 0.5f, 0.0f, 1.0f));
+    // And is a proven loss for the other side.
+    expect_same_kernels(stats, FastBoard::BLACK, 0.5f, 0.0f, 1.0f);
+    EXPECT_NE(9u, stats.select(FastBoard::BLACK, 0.5f, 0.0f, 1.0f));
+
+    // Nothing but a proven loss and pruned children: still a real child.
+    for (auto i = 0; i < 9; i++) {
+        stats.set(i, 0.1f, 4, 2.0, 0.0f, false);
+    }
+    expect_same_kernels(stats, FastBoard::BLACK, 0.5f, 0.0f, 1.0f);
+    EXPECT_LT(stats.select(FastBoard::BLACK, 0.5f, 0.0f, 1.0f), 10u);
+}
+
+TEST(UCTChildStatsTest, VirtualLoss) {
+    UCTChildStats stats;
+    stats.resize(3);
+    stats.set(0, 0.1f, 0, 0.0, 0.0f, true);
+    stats.set(1, 0.1f, 0, 0.0, 0.0f, true);
+    stats.set(2, 0.1f, 4, 3.0, 0.0f, true);
+    // An unvisited child some thread is expanding scores expanding_eval.
+    stats.add_virtual_loss(0, 3);
+    expect_same_kernels(stats, FastBoard::BLACK, 0.9f, 0.0f, 0.0f);
+    EXPECT_EQ(1u, stats.select(FastBoard::BLACK, 0.9f, 0.0f, 0.0f));
+    // Virtual losses are losses for the side to move: 3 / (4 + 6).
+    stats.add_virtual_loss(2, 6);
+    expect_same_kernels(stats, FastBoard::BLACK, 0.2f, 0.0f, 0.0f);
+    EXPECT_EQ(2u, stats.select(FastBoard::BLACK, 0.2f, 0.0f, 0.0f));
+    expect_same_kernels(stats, FastBoard::BLACK, 0.4f, 0.0f, 0.0f);
+    EXPECT_EQ(1u, stats.select(FastBoard::BLACK, 0.4f, 0.0f, 0.0f));
+    EXPECT_EQ(6, stats.get_visits(2, 3));
+}
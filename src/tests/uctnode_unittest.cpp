@@ -0,0 +1,218 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2018-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+
+#include "config.h"
+#include "FastBoard.h"
+#include "GameState.h"
+#include "SearchState.h"
+#include "UCTNode.h"
+#include "UCTNodePointer.h"
+#include "TreeHelpers.h"
+
+class UCTNodeTest : public ::testing::Test {
+protected:
+    static void SetUpTestCase() {
+        init_tree_tests();
+    }
+
+    // A simulation through child index that backs up eval.
+    static void visit(UCTNode& node, std::size_t index, float eval) {
+        const auto shares =
+            std::vector<std::pair<std::size_t, float>>{{index, 1.0f}};
+        ASSERT_EQ(index, node.share_select_child(shares));
+        node.get_children()[index]->update(eval);
+        node.update_child(index, true, eval);
+    }
+};
+
+// Recycling a subtree turns its children back into move/prior pairs. A
+// child inflated again starts from the visits and value it had.
+TEST_F(UCTNodeTest, DeflateKeepsVisitsAndValues) {
+    GameState game;
+    game.init_game(BOARD_SIZE);
+    SearchState state(game);
+    UCTNode root(FastBoard::PASS, 0.0f);
+    expand(root, state, uniform_netresult(0.5f));
+    const auto& children = root.get_children();
+
+    for (auto i = 0; i < 3; i++) {
+        visit(root, 0, 1.0f);
+    }
+    visit(root, 1, 0.0f);
+    visit(root, 1, 0.5f);
+    visit(root, 2, 1.0f);
+    children[2]->set_proven(1.0f);
+    root.refresh_child_stats();
+
+    const auto tree_size = UCTNodePointer::get_tree_size();
+    root.deflate_children();
+    EXPECT_FALSE(children[0].is_inflated());
+    EXPECT_FALSE(children[1].is_inflated());
+    // A proof is kept as it is.
+    EXPECT_TRUE(children[2].is_inflated());
+    EXPECT_EQ(tree_size - 2 * sizeof(UCTNode),
+              UCTNodePointer::get_tree_size());
+
+    // Selection still sees the visits of the deflated children.
+    EXPECT_EQ(2u, root.uct_select_child(FastBoard::BLACK, true));
+    root.update_child(2, false, 0.0f);
+
+    const auto shares = std::vector<std::pair<std::size_t, float>>{
+        {0, 1.0f}, {1, 1.0f}};
+    // The one with fewer visits.
+    EXPECT_EQ(1u, root.share_select_child(shares));
+    root.update_child(1, false, 0.0f);
+
+    visit(root, 0, 1.0f);
+    EXPECT_TRUE(children[0].is_inflated());
+    EXPECT_EQ(4, children[0]->get_visits());
+    EXPECT_FLOAT_EQ(1.0f, children[0]->get_raw_eval(FastBoard::BLACK));
+    visit(root, 1, 0.0f);
+    EXPECT_EQ(3, children[1]->get_visits());
+    EXPECT_FLOAT_EQ(0.5f / 3, children[1]->get_raw_eval(FastBoard::BLACK));
+}
+
+// Root parallel search: what another tree's copy of a node gained since
+// the last merge is added, never the same visits twice.
+TEST_F(UCTNodeTest, MergeStatsAddsOnlyTheGain) {
+    UCTNode ours(FastBoard::PASS, 0.0f);
+    UCTNode theirs(FastBoard::PASS, 0.0f);
+    ours.update(0.5f);
+    theirs.update(1.0f);
+    auto merged = theirs.get_merged_stats();
+
+    theirs.update(1.0f);
+    theirs.update(0.0f);
+    ours.merge_stats(theirs, merged);
+    EXPECT_EQ(3, ours.get_visits());
+    EXPECT_FLOAT_EQ(1.5f / 3, ours.get_raw_eval(FastBoard::BLACK));
+    ours.merge_stats(theirs, merged);
+    EXPECT_EQ(3, ours.get_visits());
+
+    ours.update(0.0f);
+    theirs.update(1.0f);
+    ours.merge_stats(theirs, merged);
+    EXPECT_EQ(5, ours.get_visits());
+    EXPECT_FLOAT_EQ(2.5f / 5, ours.get_raw_eval(FastBoard::BLACK));
+
+    // A proof holds whichever tree found it.
+    EXPECT_FALSE(ours.is_proven());
+    theirs.set_proven(0.0f);
+    ours.merge_stats(theirs, merged);
+    EXPECT_TRUE(ours.is_proven());
+    EXPECT_EQ(0.0f, ours.get_proven_eval(FastBoard::BLACK));
+    EXPECT_EQ(5, ours.get_visits());
+}
+
+// Pondering on several replies: each gets the simulations of its share,
+// counting those still on their way down.
+TEST_F(UCTNodeTest, ShareSelectFollowsTheShares) {
+    GameState game;
+    game.init_game(BOARD_SIZE);
+    SearchState state(game);
+    UCTNode root(FastBoard::PASS, 0.0f);
+    expand(root, state, uniform_netresult(0.5f));
+
+    const auto shares = std::vector<std::pair<std::size_t, float>>{
+        {3, 0.5f}, {5, 0.3f}, {8, 0.2f}};
+    for (auto i = 0; i < 100; i++) {
+        const auto index = root.share_select_child(shares);
+        root.get_children()[index]->update(0.5f);
+        root.update_child(index, true, 0.5f);
+    }
+    const auto& children = root.get_children();
+    EXPECT_NEAR(50, children[3].get_visits(), 1);
+    EXPECT_NEAR(30, children[5].get_visits(), 1);
+    EXPECT_NEAR(20, children[8].get_visits(), 1);
+
+    // In flight: the first goes to the furthest below its share, the
+    // next ones see its virtual loss.
+    auto picked = std::vector<std::size_t>{};
+    for (auto i = 0; i < 10; i++) {
+        picked.emplace_back(root.share_select_child(shares));
+    }
+    EXPECT_EQ(5, std::count(begin(picked), end(picked), 3u));
+    EXPECT_EQ(3, std::count(begin(picked), end(picked), 5u));
+    EXPECT_EQ(2, std::count(begin(picked), end(picked), 8u));
+    for (const auto index : picked) {
+        root.update_child(index, false, 0.0f);
+    }
+}
+
+// Black to move against white's four in column 3, whose end at the top
+// makes an overline for black. That five can't be blocked, so the node is
+// lost with or without the other end of the four open.
+TEST_F(UCTNodeTest, UnblockableFiveIsLost) {
+    for (const auto open_end : {false, true}) {
+        GameState game;
+        game.init_game(BOARD_SIZE);
+        for (const auto x : {0, 1, 2, 4, 5}) {
+            game.play_move(FastBoard::BLACK, game.board.get_vertex(x, 0));
+        }
+        for (const auto y : {1, 2, 3, 4}) {
+            game.play_move(FastBoard::WHITE, game.board.get_vertex(3, y));
+        }
+        const auto top = game.board.get_vertex(3, 0);
+        const auto bottom = game.board.get_vertex(3, 5);
+        if (!open_end) {
+            game.play_move(FastBoard::BLACK, bottom);
+        }
+        game.set_to_move(FastBoard::BLACK);
+        ASSERT_FALSE(game.is_move_legal(FastBoard::BLACK, top));
+
+        SearchState state(game);
+        UCTNode node(FastBoard::PASS, 0.0f);
+        std::atomic<int> nodecount{0};
+        auto eval = 0.5f;
+        auto reply = int{FastBoard::NO_VERTEX};
+        EXPECT_EQ(UCTNode::Expansion::DONE,
+                  node.prepare_expansion(nodecount, state, eval, 0.0f,
+                                         nullptr, reply));
+        EXPECT_TRUE(node.is_proven());
+        EXPECT_EQ(0.0f, node.get_proven_eval(FastBoard::BLACK));
+        EXPECT_EQ(0.0f, eval);
+
+        const auto& children = node.get_children();
+        if (open_end) {
+            // The block that is left.
+            ASSERT_EQ(1u, children.size());
+            EXPECT_EQ(bottom, children[0].get_move());
+        } else {
+            // Nothing to block, every legal move is as good.
+            EXPECT_EQ(state.get_legal_mask(FastBoard::BLACK).count(),
+                      children.size());
+        }
+    }
+}
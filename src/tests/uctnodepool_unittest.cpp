@@ -0,0 +1,123 @@
+/*
+    This file is part of Leela Zero.
+    Copyright (C) 2018-2019 Gian-Carlo Pascutto and contributors
+
+    Leela Zero is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Leela Zero is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Leela Zero.  If not, see <http://www.gnu.org/licenses/>.
+
+    Additional permission under GNU GPL version 3 section 7
+
+    If you modify this Program, or any covered work, by linking or
+    combining it with NVIDIA Corporation's libraries from the
+    NVIDIA CUDA Toolkit and/or the NVIDIA CUDA Deep Neural
+    Network library and/or the NVIDIA TensorRT inference library
+    (or a modified version of those libraries), containing parts covered
+    by the terms of the respective license agreement, the licensors of
+    this Program grant you additional permission to convey the resulting
+    work.
+*/
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "config.h"
+#include "UCTNode.h"
+#include "UCTNodePointer.h"
+#include "UCTNodePool.h"
+
+// More than two slabs and more than the two batches a thread keeps.
+constexpr auto NODES = 5000;
+
+static std::unique_ptr<UCTNodeList> make_children(int count) {
+    auto children = std::make_unique<UCTNodeList>();
+    for (auto i = 0; i < count; i++) {
+        children->emplace_back(i, 1.0f / count);
+        children->back().inflate();
+    }
+    return children;
+}
+
+TEST(UCTNodePoolTest, TreeSizeCountsNodes) {
+    const auto base = UCTNodePointer::get_tree_size();
+    {
+        UCTNodeList children;
+        for (auto i = 0; i < 10; i++) {
+            children.emplace_back(i, 0.1f);
+        }
+        EXPECT_EQ(base + 10 * sizeof(UCTNodePointer),
+                  UCTNodePointer::get_tree_size());
+
+        EXPECT_TRUE(children[3].inflate());
+        EXPECT_FALSE(children[3].inflate());
+        auto node = children[3].get();
+        EXPECT_EQ(base + 10 * sizeof(UCTNodePointer) + sizeof(UCTNode),
+                  UCTNodePointer::get_tree_size());
+
+        // Growing the list moves the pointers, not the nodes.
+        for (auto i = 10; i < 100; i++) {
+            children.emplace_back(i, 0.01f);
+        }
+        EXPECT_EQ(node, children[3].get());
+        EXPECT_EQ(3, children[3].get_move());
+        EXPECT_EQ(base + 100 * sizeof(UCTNodePointer) + sizeof(UCTNode),
+                  UCTNodePointer::get_tree_size());
+
+        children[3].deflate();
+        EXPECT_FALSE(children[3].is_inflated());
+        EXPECT_EQ(base + 100 * sizeof(UCTNodePointer),
+                  UCTNodePointer::get_tree_size());
+
+        children[4].inflate();
+        auto released = std::unique_ptr<UCTNode>(children[4].release());
+        EXPECT_EQ(base + 100 * sizeof(UCTNodePointer),
+                  UCTNodePointer::get_tree_size());
+        children[5].inflate();
+    }
+    EXPECT_EQ(base, UCTNodePointer::get_tree_size());
+}
+
+TEST(UCTNodePoolTest, NodesTakeWholeCacheLines) {
+    auto children = make_children(NODES);
+    auto lines = std::set<std::uintptr_t>{};
+    for (const auto& child : *children) {
+        auto address = reinterpret_cast<std::uintptr_t>(child.get());
+        EXPECT_EQ(0u, address % 64);
+        lines.insert(address / 64);
+    }
+    EXPECT_EQ(size_t{NODES}, lines.size());
+}
+
+TEST(UCTNodePoolTest, FreeOnOtherThread) {
+    const auto base = UCTNodePointer::get_tree_size();
+    std::unique_ptr<UCTNodeList> children;
+
+    std::thread([&children]() { children = make_children(NODES); }).join();
+    EXPECT_EQ(base + NODES * (sizeof(UCTNodePointer) + sizeof(UCTNode)),
+              UCTNodePointer::get_tree_size());
+
+    // Freed by a thread that didn't allocate them, which then exits.
+    std::thread([&children]() { children.reset(); }).join();
+    EXPECT_EQ(base, UCTNodePointer::get_tree_size());
+
+    // The freed nodes went back to the shared pool: a third thread
+    // gets them without reserving another slab.
+    const auto reserved = UCTNodePool::get_reserved_bytes();
+    std::thread([&children]() { children = make_children(NODES); }).join();
+    EXPECT_EQ(reserved, UCTNodePool::get_reserved_bytes());
+    children.reset();
+    EXPECT_EQ(base, UCTNodePointer::get_tree_size());
+}